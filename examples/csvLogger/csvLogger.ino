@@ -35,6 +35,13 @@ bool appenRow() {
   snprintf(filename, sizeof(filename), "%s/%04d_%02d_%02d.csv", basePath,
            ntpTime.tm_year + 1900, ntpTime.tm_mon + 1, ntpTime.tm_mday);
 
+  // Make room for the row (and the header of a new file): the oldest files of
+  // basePath are deleted when the folder is over its retention policy
+  if (!server.reserveSpace(filename, 128)) {
+    Serial.println("No space left for the log");
+    return false;
+  }
+
   File file;
   if (LittleFS.exists(filename)) {
     file = LittleFS.open(filename, "a");  // Append to existing file
@@ -62,6 +69,8 @@ bool appenRow() {
     Serial.println(row);
     file.println(row);
     file.close();
+    // File size changed: let the webserver re-read its metadata (ETag, size)
+    server.notifyFsChange(filename);
     return true;
   }
 
@@ -105,12 +114,19 @@ void setup() {
   if (!LittleFS.exists(basePath)) {
     LittleFS.mkdir(basePath);
   }
+
+  // Keep at most 30 daily files and 256KB of logs, and never fill the filesystem
+  RetentionPolicy policy;
+  policy.maxFiles = 30;
+  policy.maxBytes = 256 * 1024;
+  policy.minFree = 16 * 1024;
+  server.addRetention(basePath, policy);
   Serial.println("Setup completed.");
 }
 
 void loop() {
-  server.handleClient();
-  if (server.isAccessPointMode()) server.updateDNS();
+  // Serve clients, and delete old logs in the background
+  server.run();
 
   static uint32_t updateTime;
   if (millis() - updateTime > 30000) {
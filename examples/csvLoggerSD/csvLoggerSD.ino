@@ -89,6 +89,8 @@ bool appenRow() {
     Serial.println(row);
     file.println(row);
     file.close();
+    // File size changed: let the webserver re-read its metadata (ETag, size)
+    server.invalidateFileCache();
     return true;
   }
 
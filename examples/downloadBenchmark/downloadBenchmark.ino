@@ -0,0 +1,108 @@
+/*
+  Download benchmark (ESP32).
+  Creates a 1 MB file on LittleFS and serves it in two ways, so a plain loop can be compared
+  with the path used by the library for large files on the same board and WiFi link:
+    - GET /bench/inline: single buffer loop, read ESP_FS_WS_STREAM_CHUNK bytes then send them
+                         (what ESP_FS_WS_STREAM_TASK=0 does). The time spent and the throughput
+                         (KB/s) are printed on the serial monitor (115200 baud)
+    - GET /bench.bin:    the file served by the library, through the transfer pool and
+                         FileStreamer (a reader task fills one buffer while the other one is sent),
+                         with the buffers set by setStreamBuffers()
+  From a PC on the same network:
+    curl -o /dev/null -w "%{speed_download}\n" http://esphost.local/bench/inline
+    curl -o /dev/null -w "%{speed_download}\n" http://esphost.local/bench.bin
+  Repeat a few times and compare: WiFi throughput varies from one run to the next.
+*/
+#include <Arduino.h>
+#include <FS.h>
+#include <LittleFS.h>
+#include <FSWebServer.h>
+
+#if !defined(ESP32)
+#error "The reader task (FileStreamer) is available on ESP32 only"
+#endif
+
+#define TEST_FILE   "/bench.bin"
+#define TEST_SIZE   (1024 * 1024)
+#define BUFFER_SIZE 8192        // Each of the two FileStreamer buffers
+#define USE_PSRAM   false
+
+FSWebServer server(LittleFS, 80, "esphost");
+
+bool createTestFile() {
+  File file = LittleFS.open(TEST_FILE, "r");
+  if (file && file.size() == TEST_SIZE) {
+    return true;
+  }
+  file.close();
+  file = LittleFS.open(TEST_FILE, "w");
+  if (!file) {
+    return false;
+  }
+  uint8_t block[1024];
+  for (size_t i = 0; i < sizeof(block); i++) {
+    block[i] = (uint8_t)i;
+  }
+  for (size_t written = 0; written < TEST_SIZE; written += sizeof(block)) {
+    if (file.write(block, sizeof(block)) != sizeof(block)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void report(const char *label, size_t sent, uint32_t elapsed) {
+  Serial.printf("%-7s %7u bytes in %5u ms: %4u KB/s\n", label, (unsigned)sent, (unsigned)elapsed,
+                (unsigned)(elapsed ? sent / elapsed : 0));
+}
+
+void sendInline() {
+  File file = LittleFS.open(TEST_FILE, "r");
+  server.setContentLength(file.size());
+  server.send(200, "application/octet-stream", "");
+
+  uint8_t *buf = (uint8_t *)malloc(ESP_FS_WS_STREAM_CHUNK);
+  size_t sent = 0;
+  uint32_t start = millis();
+  size_t len;
+  while (buf && (len = file.read(buf, ESP_FS_WS_STREAM_CHUNK)) > 0) {
+    size_t written = server.client().write(buf, len);
+    sent += written;
+    if (written != len) {
+      break;
+    }
+  }
+  report("inline", sent, millis() - start);
+  free(buf);
+  file.close();
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(1000);
+  if (!LittleFS.begin()) {
+    Serial.println("LittleFS mount failed, formatting");
+    LittleFS.format();
+    ESP.restart();
+  }
+  if (!createTestFile()) {
+    Serial.println("Can't create " TEST_FILE);
+    return;
+  }
+
+  if (!server.startWiFi(10000)) {
+    Serial.println("\nWiFi not connected! Starting AP mode...");
+    server.startCaptivePortal("ESP_BENCH", "123456789", "/setup");
+  }
+  server.on("/bench/inline", HTTP_GET, sendInline);
+  // Anything else, /bench.bin included, is served from the filesystem by the library
+  server.setStreamBuffers(BUFFER_SIZE, USE_PSRAM);
+  server.begin();
+  Serial.print(F("Download benchmark ready: http://"));
+  Serial.print(server.getServerIP());
+  Serial.println(F("/bench/inline and " TEST_FILE));
+}
+
+void loop() {
+  server.run();
+}
@@ -0,0 +1,70 @@
+/*
+  Upload write benchmark.
+  Writes the same file twice on LittleFS, emulating the chunks handed over by the
+  multipart upload parser (HTTP_UPLOAD_BUFLEN, 1436 bytes on ESP32):
+    - "direct":   every chunk written to the file as it arrives (previous upload behaviour)
+    - "buffered": chunks collected by BlockWriter and written as whole 4 KB blocks
+  and prints the throughput (KB/s) and the number of File::write() calls for each run.
+  No WiFi is needed, open the serial monitor at 115200 baud.
+*/
+#include <Arduino.h>
+#include <FS.h>
+#include <LittleFS.h>
+#include <BlockWriter.h>
+
+#define TEST_FILE   "/bench.bin"
+#define TEST_SIZE   (256 * 1024)
+#define CHUNK_SIZE  1436
+
+static uint8_t chunk[CHUNK_SIZE];
+
+void runTest(const char *label, size_t bufferSize) {
+  LittleFS.remove(TEST_FILE);
+  File file = LittleFS.open(TEST_FILE, "w");
+  if (!file) {
+    Serial.println("Can't create " TEST_FILE);
+    return;
+  }
+
+  BlockWriter writer(bufferSize);
+  uint32_t start = millis();
+  writer.begin(file);
+  size_t left = TEST_SIZE;
+  while (left) {
+    size_t n = left < CHUNK_SIZE ? left : CHUNK_SIZE;
+    if (writer.write(chunk, n) != n) {
+      Serial.println("Write failed (filesystem full?)");
+      break;
+    }
+    left -= n;
+  }
+  writer.end();
+  file.close();
+  uint32_t elapsed = millis() - start;
+
+  Serial.printf("%-9s %6u bytes in %5u ms: %4u KB/s, %4u flash writes\n", label,
+                (unsigned)writer.bytesWritten(), (unsigned)elapsed,
+                (unsigned)(elapsed ? writer.bytesWritten() / elapsed : 0),
+                (unsigned)writer.flashWrites());
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(1000);
+  if (!LittleFS.begin()) {
+    Serial.println("LittleFS mount failed, formatting");
+    LittleFS.format();
+    ESP.restart();
+  }
+  for (size_t i = 0; i < sizeof(chunk); i++) {
+    chunk[i] = (uint8_t)i;
+  }
+
+  for (int run = 0; run < 3; run++) {
+    runTest("direct", 0);
+    runTest("buffered", 4096);
+  }
+  LittleFS.remove(TEST_FILE);
+}
+
+void loop() {}
@@ -0,0 +1,206 @@
+#include "ArchiveWriter.h"
+#include "Crc32.h"
+#include "HttpUtils.h"
+#include "SerialLog.h"
+
+static void put16(uint8_t *p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void put32(uint8_t *p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+// MS-DOS time and date used by ZIP headers (1980-01-01 for files written with the clock not set)
+static void dosTime(time_t mtime, uint16_t &time, uint16_t &date) {
+    if (mtime < HttpUtils::MIN_VALID_TIME) {
+        time = 0;
+        date = (1 << 5) | 1;
+        return;
+    }
+    struct tm tm;
+    localtime_r(&mtime, &tm);
+    time = (tm.tm_hour << 11) | (tm.tm_min << 5) | (tm.tm_sec / 2);
+    date = ((tm.tm_year - 80) << 9) | ((tm.tm_mon + 1) << 5) | tm.tm_mday;
+}
+
+void ArchiveWriter::emit(const void *data, size_t length) {
+    m_out.write((const uint8_t *)data, length);
+    m_offset += length;
+}
+
+bool ArchiveWriter::addDirectory(const String &name, time_t mtime) {
+    if (m_format == TAR) {
+        return tarHeader(name, 0, mtime, true);
+    }
+    ZipEntry entry = {name + "/", 0, 0, m_offset, 0, 0, true};
+    zipLocalHeader(entry, mtime);
+    m_entries.push_back(entry);
+    m_count++;
+    return true;
+}
+
+bool ArchiveWriter::addFile(const String &name, File &file, time_t mtime, uint8_t *buf, size_t bufSize) {
+    uint32_t declared = file.size() - file.position();
+    if (m_format == TAR) {
+        if (!tarHeader(name, declared, mtime, false)) {
+            return false;
+        }
+        uint32_t left = declared;
+        while (left) {
+            size_t n = file.read(buf, left < bufSize ? left : bufSize);
+            if (n == 0) {
+                // File shrunk while reading: keep the declared size
+                memset(buf, 0, bufSize);
+                n = left < bufSize ? left : bufSize;
+            }
+            emit(buf, n);
+            left -= n;
+        }
+        static const uint8_t zeros[512] = {0};
+        if (declared % 512) {
+            emit(zeros, 512 - declared % 512);
+        }
+        m_count++;
+        return true;
+    }
+
+    ZipEntry entry = {name, 0, 0, m_offset, 0, 0, false};
+    zipLocalHeader(entry, mtime);
+    size_t n;
+    while ((n = file.read(buf, bufSize)) > 0) {
+        entry.crc = Crc32::update(entry.crc, buf, n);
+        entry.size += n;
+        emit(buf, n);
+    }
+    uint8_t descriptor[16];
+    put32(descriptor, 0x08074b50);
+    put32(descriptor + 4, entry.crc);
+    put32(descriptor + 8, entry.size);
+    put32(descriptor + 12, entry.size);
+    emit(descriptor, sizeof(descriptor));
+    m_entries.push_back(entry);
+    m_count++;
+    return true;
+}
+
+void ArchiveWriter::zipLocalHeader(ZipEntry &entry, time_t mtime) {
+    dosTime(mtime, entry.time, entry.date);
+    uint8_t header[30];
+    put32(header, 0x04034b50);
+    put16(header + 4, 20);                          // Version needed: 2.0
+    put16(header + 6, entry.dir ? 0x0800 : 0x0808); // UTF-8 names, sizes in the data descriptor
+    put16(header + 8, 0);                           // Stored
+    put16(header + 10, entry.time);
+    put16(header + 12, entry.date);
+    put32(header + 14, 0);
+    put32(header + 18, 0);
+    put32(header + 22, 0);
+    put16(header + 26, entry.name.length());
+    put16(header + 28, 0);
+    emit(header, sizeof(header));
+    emit(entry.name.c_str(), entry.name.length());
+}
+
+void ArchiveWriter::zipCentralEntry(const ZipEntry &entry) {
+    uint8_t header[46];
+    put32(header, 0x02014b50);
+    put16(header + 4, (3 << 8) | 20);               // Made by: Unix, 2.0 (external attributes hold the mode)
+    put16(header + 6, 20);
+    put16(header + 8, entry.dir ? 0x0800 : 0x0808);
+    put16(header + 10, 0);
+    put16(header + 12, entry.time);
+    put16(header + 14, entry.date);
+    put32(header + 16, entry.crc);
+    put32(header + 20, entry.size);
+    put32(header + 24, entry.size);
+    put16(header + 28, entry.name.length());
+    put16(header + 30, 0);
+    put16(header + 32, 0);
+    put16(header + 34, 0);
+    put16(header + 36, 0);
+    put32(header + 38, entry.dir ? (040755u << 16) | 0x10 : (0100644u << 16));
+    put32(header + 42, entry.offset);
+    emit(header, sizeof(header));
+    emit(entry.name.c_str(), entry.name.length());
+}
+
+bool ArchiveWriter::tarHeader(const String &name, uint32_t size, time_t mtime, bool dir) {
+    String path = dir ? name + "/" : name;
+    size_t split = 0;
+    if (path.length() > 100) {
+        // ustar: prefix (155) + '/' + name (100), split on a folder separator
+        int slash = path.indexOf('/');
+        while (slash >= 0 && path.length() - slash - 1 > 100) {
+            slash = path.indexOf('/', slash + 1);
+        }
+        if (slash <= 0 || slash > 155) {
+            log_error("Name too long for tar: %s", path.c_str());
+            return false;
+        }
+        split = slash;
+    }
+
+    char header[512];
+    memset(header, 0, sizeof(header));
+    if (split) {
+        memcpy(header, path.c_str() + split + 1, path.length() - split - 1);
+        memcpy(header + 345, path.c_str(), split);
+    }
+    else {
+        memcpy(header, path.c_str(), path.length());
+    }
+    snprintf(header + 100, 8, "%07o", dir ? 0755 : 0644);
+    snprintf(header + 108, 8, "%07o", 0);
+    snprintf(header + 116, 8, "%07o", 0);
+    snprintf(header + 124, 12, "%011lo", (unsigned long)size);
+    snprintf(header + 136, 12, "%011lo", (unsigned long)(mtime > 0 ? mtime : 0));
+    header[156] = dir ? '5' : '0';
+    memcpy(header + 257, "ustar", 6);
+    memcpy(header + 263, "00", 2);
+
+    // Checksum computed with the checksum field set to spaces
+    memset(header + 148, ' ', 8);
+    uint32_t sum = 0;
+    for (size_t i = 0; i < sizeof(header); i++) {
+        sum += (uint8_t)header[i];
+    }
+    snprintf(header + 148, 8, "%06lo", (unsigned long)sum);
+    header[155] = ' ';
+
+    emit(header, sizeof(header));
+    if (dir) {
+        m_count++;
+    }
+    return true;
+}
+
+void ArchiveWriter::finish() {
+    if (m_format == TAR) {
+        // Two empty blocks
+        static const uint8_t zeros[512] = {0};
+        emit(zeros, sizeof(zeros));
+        emit(zeros, sizeof(zeros));
+        return;
+    }
+
+    uint32_t start = m_offset;
+    for (const ZipEntry &entry : m_entries) {
+        zipCentralEntry(entry);
+    }
+    uint8_t end[22];
+    put32(end, 0x06054b50);
+    put16(end + 4, 0);
+    put16(end + 6, 0);
+    put16(end + 8, m_entries.size());
+    put16(end + 10, m_entries.size());
+    put32(end + 12, m_offset - start);
+    put32(end + 16, start);
+    put16(end + 20, 0);
+    emit(end, sizeof(end));
+    m_entries.clear();
+}
@@ -0,0 +1,65 @@
+#ifndef ARCHIVE_WRITER_H
+#define ARCHIVE_WRITER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <vector>
+
+/*
+  Streaming archive encoder.
+  Entries are written to out as soon as they are added, file content is copied a buffer
+  at a time, so memory doesn't depend on the size of the files:
+  - ZIP: store mode (no compression), CRC32 and sizes in a data descriptor after the data,
+    so nothing has to be known in advance. Only name, CRC and offset of each entry are kept
+    until finish() writes the central directory.
+  - TAR: POSIX ustar, nothing is kept. Names longer than 100 characters are split in
+    prefix / name; entries that can't be stored (over 255 characters) are skipped.
+*/
+class ArchiveWriter {
+public:
+  enum Format : uint8_t { ZIP, TAR };
+
+  ArchiveWriter(Print &out, Format format) : m_out(out), m_format(format) {}
+
+  /*
+    Add a folder. name is the path inside the archive, without leading or trailing '/'
+  */
+  bool addDirectory(const String &name, time_t mtime);
+
+  /*
+    Add a file, copying its content (from the current position to the end) with buf
+  */
+  bool addFile(const String &name, File &file, time_t mtime, uint8_t *buf, size_t bufSize);
+
+  /*
+    Write the archive trailer (ZIP central directory, TAR end blocks)
+  */
+  void finish();
+
+  inline size_t bytesWritten() const { return m_offset; }
+  inline size_t entries() const { return m_count; }
+
+private:
+  struct ZipEntry {
+    String name;
+    uint32_t crc;
+    uint32_t size;
+    uint32_t offset;
+    uint16_t time;
+    uint16_t date;
+    bool dir;
+  };
+
+  Print &m_out;
+  Format m_format;
+  uint32_t m_offset = 0;
+  size_t m_count = 0;
+  std::vector<ZipEntry> m_entries;
+
+  void emit(const void *data, size_t length);
+  void zipLocalHeader(ZipEntry &entry, time_t mtime);
+  void zipCentralEntry(const ZipEntry &entry);
+  bool tarHeader(const String &name, uint32_t size, time_t mtime, bool dir);
+};
+
+#endif
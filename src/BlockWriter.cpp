@@ -0,0 +1,90 @@
+#include "BlockWriter.h"
+#include "SerialLog.h"
+#if defined(ESP32)
+#include <esp_heap_caps.h>
+#endif
+
+BlockWriter::BlockWriter(size_t bufferSize, bool psram) {
+    setBuffer(bufferSize, psram);
+}
+
+void BlockWriter::setBuffer(size_t bufferSize, bool psram) {
+    m_bufferSize = ((bufferSize + ESP_FS_WS_FS_BLOCK_SIZE - 1) / ESP_FS_WS_FS_BLOCK_SIZE) * ESP_FS_WS_FS_BLOCK_SIZE;
+    m_psram = psram;
+}
+
+BlockWriter::~BlockWriter() {
+    end();
+}
+
+void BlockWriter::begin(File &file) {
+    end();
+    m_file = &file;
+    m_total = 0;
+    m_writes = 0;
+    m_error = false;
+    m_len = 0;
+    if (m_bufferSize) {
+#if defined(ESP32)
+        if (m_psram) {
+            m_buffer = (uint8_t *)heap_caps_malloc(m_bufferSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        }
+#endif
+        if (!m_buffer) {
+            m_buffer = (uint8_t *)malloc(m_bufferSize);
+        }
+        if (!m_buffer) {
+            log_error("Not enough memory for write buffer, writing through");
+        }
+    }
+    m_fill = m_bufferSize - (file.position() % ESP_FS_WS_FS_BLOCK_SIZE);
+}
+
+size_t BlockWriter::write(const uint8_t *data, size_t len) {
+    if (!m_file || m_error) {
+        return 0;
+    }
+    if (!m_buffer) {
+        // No buffer: write through
+        size_t written = m_file->write(data, len);
+        m_writes++;
+        m_total += written;
+        m_error = written != len;
+        return m_error ? 0 : len;
+    }
+
+    size_t left = len;
+    while (left) {
+        size_t n = m_fill - m_len;
+        n = n < left ? n : left;
+        memcpy(m_buffer + m_len, data, n);
+        m_len += n;
+        data += n;
+        left -= n;
+        if (m_len == m_fill && !flush()) {
+            return 0;
+        }
+    }
+    m_total += len;
+    return len;
+}
+
+bool BlockWriter::flush() {
+    if (!m_file || !m_len) {
+        return !m_error;
+    }
+    size_t written = m_file->write(m_buffer, m_len);
+    m_writes++;
+    m_error = written != m_len;
+    m_len = 0;
+    m_fill = m_bufferSize;
+    return !m_error;
+}
+
+bool BlockWriter::end() {
+    bool ok = flush();
+    free(m_buffer);
+    m_buffer = nullptr;
+    m_file = nullptr;
+    return ok;
+}
@@ -0,0 +1,75 @@
+#ifndef BLOCK_WRITER_H
+#define BLOCK_WRITER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "FileStreamer.h"   // ESP_FS_WS_FS_BLOCK_SIZE
+
+// Write buffer used for uploads (rounded to a multiple of ESP_FS_WS_FS_BLOCK_SIZE). 0 = write through
+#ifndef ESP_FS_WS_UPLOAD_BUFFER
+#define ESP_FS_WS_UPLOAD_BUFFER 4096
+#endif
+
+// Allocate the upload buffer in PSRAM when available (ESP32)
+#ifndef ESP_FS_WS_UPLOAD_PSRAM
+#define ESP_FS_WS_UPLOAD_PSRAM 0
+#endif
+
+/*
+  Write coalescing for an open file.
+  Small writes (e.g. the ~1.4 KB chunks of the multipart parser) are collected and
+  handed to the filesystem as whole blocks, aligned to the block boundaries of the file,
+  so LittleFS programs each block once instead of rewriting a partial block and its
+  metadata on every chunk. If the buffer can't be allocated data is written through.
+*/
+class BlockWriter {
+public:
+  BlockWriter(size_t bufferSize = ESP_FS_WS_UPLOAD_BUFFER, bool psram = ESP_FS_WS_UPLOAD_PSRAM);
+  ~BlockWriter();
+
+  BlockWriter(const BlockWriter &) = delete;
+  BlockWriter &operator=(const BlockWriter &) = delete;
+
+  /*
+    Change the buffer size (rounded up to the block size, 0 = write through) and allocation.
+    Takes effect on the next begin()
+  */
+  void setBuffer(size_t bufferSize, bool psram = false);
+
+  /*
+    Start buffering writes to file (open for writing), from its current position
+  */
+  void begin(File &file);
+
+  /*
+    Append data. Returns len, or 0 if the filesystem refused a block (e.g. full)
+  */
+  size_t write(const uint8_t *data, size_t len);
+
+  /*
+    Write the buffered bytes to the file. Returns false on a short write
+  */
+  bool flush();
+
+  /*
+    Flush and release the buffer. The file itself is not closed
+  */
+  bool end();
+
+  inline size_t bytesWritten() const { return m_total; }   // Bytes accepted by write()
+  inline uint32_t flashWrites() const { return m_writes; }  // File::write() calls issued
+  inline bool buffered() const { return m_buffer != nullptr; }
+
+private:
+  size_t m_bufferSize;
+  bool m_psram;
+  File *m_file = nullptr;
+  uint8_t *m_buffer = nullptr;
+  size_t m_len = 0;
+  size_t m_fill = 0;         // Bytes to collect before the next flush (first one ends on a block boundary)
+  size_t m_total = 0;
+  uint32_t m_writes = 0;
+  bool m_error = false;
+};
+
+#endif
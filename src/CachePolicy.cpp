@@ -0,0 +1,99 @@
+#include "CachePolicy.h"
+#include "HttpUtils.h"
+#include "SerialLog.h"
+
+void CachePolicy::addRule(const char *pattern, uint32_t maxAge, uint8_t flags) {
+    insertRule(pattern, maxAge, flags, false);
+}
+
+void CachePolicy::insertRule(const char *pattern, uint32_t maxAge, uint8_t flags, bool fromConfig) {
+    if (!pattern || !*pattern) {
+        return;
+    }
+    Rule rule;
+    rule.pattern = pattern;
+    rule.header = buildHeader(maxAge, flags);
+    rule.fromConfig = fromConfig;
+    log_debug("Cache rule %s -> %s", pattern, rule.header.c_str());
+
+    if (fromConfig) {
+        m_rules.push_back(rule);
+    } else {
+        m_rules.insert(m_rules.begin() + m_codeRules, rule);
+        m_codeRules++;
+    }
+}
+
+void CachePolicy::clear(bool fromConfig) {
+    if (fromConfig) {
+        m_rules.erase(m_rules.begin() + m_codeRules, m_rules.end());
+    } else {
+        m_rules.erase(m_rules.begin(), m_rules.begin() + m_codeRules);
+        m_codeRules = 0;
+    }
+}
+
+size_t CachePolicy::load(const cJSON *section) {
+    clear(true);
+    const cJSON *rules = section ? cJSON_GetObjectItemCaseSensitive(section, "rules") : nullptr;
+    if (!cJSON_IsArray(rules)) {
+        return 0;
+    }
+
+    size_t count = 0;
+    for (const cJSON *item = rules->child; item; item = item->next) {
+        const cJSON *match = cJSON_GetObjectItemCaseSensitive(item, "match");
+        if (!cJSON_IsString(match) || !match->valuestring) {
+            log_error("Cache rule without \"match\" skipped");
+            continue;
+        }
+        const cJSON *maxAge = cJSON_GetObjectItemCaseSensitive(item, "max-age");
+        uint8_t flags = NONE;
+        if (cJSON_IsTrue(cJSON_GetObjectItemCaseSensitive(item, "immutable"))) {
+            flags |= IMMUTABLE;
+        }
+        if (cJSON_IsTrue(cJSON_GetObjectItemCaseSensitive(item, "no-store"))) {
+            flags |= NO_STORE;
+        }
+        if (cJSON_IsTrue(cJSON_GetObjectItemCaseSensitive(item, "private"))) {
+            flags |= PRIVATE;
+        }
+        uint32_t seconds = cJSON_IsNumber(maxAge) && maxAge->valuedouble > 0 ? (uint32_t)maxAge->valuedouble : 0;
+        insertRule(match->valuestring, seconds, flags, true);
+        count++;
+    }
+    return count;
+}
+
+const char *CachePolicy::lookup(const String &path, const char *fallback) const {
+    for (const Rule &rule : m_rules) {
+        if (match(rule.pattern.c_str(), path.c_str())) {
+            return rule.header.c_str();
+        }
+    }
+    return fallback;
+}
+
+bool CachePolicy::match(const char *pattern, const char *path) {
+    // Folder prefix: "/assets/" matches "/assets/js/app.js"
+    size_t len = strlen(pattern);
+    if (len && pattern[len - 1] == '/' && !strpbrk(pattern, "*?")) {
+        return strncmp(pattern, path, len) == 0;
+    }
+    return HttpUtils::globMatch(pattern, path);
+}
+
+String CachePolicy::buildHeader(uint32_t maxAge, uint8_t flags) {
+    if (flags & NO_STORE) {
+        return String("no-store");
+    }
+    if (maxAge == 0) {
+        return String(flags & PRIVATE ? "private, no-cache" : "no-cache");
+    }
+    String header = flags & PRIVATE ? "private, max-age=" : "public, max-age=";
+    header += maxAge;
+    if (flags & IMMUTABLE) {
+        header += ", immutable";
+    }
+    return header;
+}
@@ -0,0 +1,75 @@
+#ifndef CACHE_POLICY_H
+#define CACHE_POLICY_H
+
+#include <Arduino.h>
+#include <vector>
+extern "C" {
+#include "json/cJSON.h"
+}
+
+// Cache-Control sent when no rule matches: clients store the response but revalidate it
+// (ETag / Last-Modified) on every use
+#ifndef ESP_FS_WS_CACHE_DEFAULT
+#define ESP_FS_WS_CACHE_DEFAULT "no-cache"
+#endif
+
+/*
+  Cache-Control rule table.
+  A pattern ending with '/' (and without wildcards) matches every path under that folder,
+  otherwise it is a glob where '*' matches any sequence of characters and '?' a single one,
+  e.g. "/assets/", "*.css", "/img/icon-*.png", "/app.*.js".
+  Rules are evaluated in order, the first match wins. Rules added from code always come
+  before the ones loaded from the "_cache" section of config.json.
+*/
+class CachePolicy {
+public:
+  enum Flags : uint8_t {
+    NONE = 0,
+    IMMUTABLE = 1 << 0,   // Content never changes for this URL (e.g. hashed file names)
+    NO_STORE = 1 << 1,    // Never store the response (max-age is ignored)
+    PRIVATE = 1 << 2      // Only the browser may store the response, not shared caches
+  };
+
+  /*
+    Append a rule. maxAge is in seconds, 0 means "no-cache" (store but always revalidate)
+  */
+  void addRule(const char *pattern, uint32_t maxAge, uint8_t flags = NONE);
+
+  /*
+    Remove all the rules added from code (fromConfig == false) or loaded from config.json
+  */
+  void clear(bool fromConfig = false);
+
+  /*
+    Replace the config.json rules with the content of a "_cache" section:
+      { "rules": [ {"match": "/assets/", "max-age": 31536000, "immutable": true},
+                   {"match": "*.json", "no-store": true} ] }
+    Returns the number of rules loaded
+  */
+  size_t load(const cJSON *section);
+
+  /*
+    Cache-Control value for path. fallback is returned when no rule matches
+  */
+  const char *lookup(const String &path, const char *fallback = ESP_FS_WS_CACHE_DEFAULT) const;
+
+  /*
+    True if path matches pattern, with the rule syntax described above
+  */
+  static bool match(const char *pattern, const char *path);
+
+private:
+  struct Rule {
+    String pattern;
+    String header;        // Pre-built Cache-Control value
+    bool fromConfig;
+  };
+
+  std::vector<Rule> m_rules;
+  size_t m_codeRules = 0;   // Code rules are kept at the front of m_rules
+
+  static String buildHeader(uint32_t maxAge, uint8_t flags);
+  void insertRule(const char *pattern, uint32_t maxAge, uint8_t flags, bool fromConfig);
+};
+
+#endif
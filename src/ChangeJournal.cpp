@@ -0,0 +1,45 @@
+#include "ChangeJournal.h"
+
+static constexpr size_t JOURNAL_SLOTS = ESP_FS_WS_CHANGE_JOURNAL ? ESP_FS_WS_CHANGE_JOURNAL : 1;
+
+const FsChange &ChangeJournal::add(const String &path, FsChangeType type) {
+    FsChange &newest = m_entries[(m_next + JOURNAL_SLOTS - 1) % JOURNAL_SLOTS];
+    if (newest.seq && newest.type == type && newest.path == path) {
+        newest.seq = ++m_seq;
+        return newest;
+    }
+    FsChange &entry = m_entries[m_next];
+    if (entry.seq) {
+        m_dropped = entry.seq;
+    }
+    m_next = (m_next + 1) % JOURNAL_SLOTS;
+    entry.seq = ++m_seq;
+    entry.type = type;
+    entry.path = path;
+    return entry;
+}
+
+bool ChangeJournal::since(uint32_t seq, const ChangeCallbackF &cb) const {
+    if (seq > m_seq) {
+        return false;
+    }
+    // From the oldest slot (m_next, once the ring is full)
+    for (size_t i = 0; i < JOURNAL_SLOTS; i++) {
+        const FsChange &entry = m_entries[(m_next + i) % JOURNAL_SLOTS];
+        if (entry.seq > seq) {
+            cb(entry);
+        }
+    }
+    return seq >= m_dropped;
+}
+
+const char *ChangeJournal::typeName(FsChangeType type) {
+    switch (type) {
+        case FS_CHANGE_CREATED:
+            return "created";
+        case FS_CHANGE_DELETED:
+            return "deleted";
+        default:
+            return "modified";
+    }
+}
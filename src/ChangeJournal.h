@@ -0,0 +1,49 @@
+#ifndef CHANGE_JOURNAL_H
+#define CHANGE_JOURNAL_H
+
+#include <Arduino.h>
+#include <functional>
+
+// Filesystem changes remembered for /changes (0 disables the journal)
+#ifndef ESP_FS_WS_CHANGE_JOURNAL
+#define ESP_FS_WS_CHANGE_JOURNAL 32
+#endif
+
+enum FsChangeType : uint8_t { FS_CHANGE_MODIFIED = 0, FS_CHANGE_CREATED, FS_CHANGE_DELETED };
+
+struct FsChange {
+  uint32_t seq = 0;           // 0 = unused slot
+  FsChangeType type = FS_CHANGE_MODIFIED;
+  String path;                // File, or folder whose content changed
+};
+
+/*
+  Ring of the last filesystem changes, numbered with an increasing sequence number, so a
+  client that has seen up to seq only needs the newer entries instead of listing folders
+  again. A change of the same path and type as the newest entry replaces it (e.g. a log
+  written line by line), so repeated writes don't flush the older entries out
+*/
+class ChangeJournal {
+public:
+  using ChangeCallbackF = std::function<void(const FsChange &change)>;
+
+  const FsChange &add(const String &path, FsChangeType type);
+
+  /*
+    Call cb, oldest first, for the entries newer than seq. Returns false if some of them
+    were already dropped (or seq is from before a reboot): the client must reload everything
+  */
+  bool since(uint32_t seq, const ChangeCallbackF &cb) const;
+
+  inline uint32_t seq() const { return m_seq; }
+
+  static const char *typeName(FsChangeType type);
+
+private:
+  FsChange m_entries[ESP_FS_WS_CHANGE_JOURNAL ? ESP_FS_WS_CHANGE_JOURNAL : 1];
+  size_t m_next = 0;          // Slot of the next entry
+  uint32_t m_seq = 0;         // Sequence number of the newest entry
+  uint32_t m_dropped = 0;     // Sequence number of the last entry overwritten
+};
+
+#endif
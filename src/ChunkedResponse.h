@@ -0,0 +1,115 @@
+#ifndef CHUNKED_RESPONSE_H
+#define CHUNKED_RESPONSE_H
+
+#include <Arduino.h>
+
+// Bytes collected before a chunk is written to the client
+#ifndef ESP_FS_WS_CHUNK_BUFFER
+#define ESP_FS_WS_CHUNK_BUFFER 512
+#endif
+
+/*
+  Print adapter for responses of unknown length (chunked transfer encoding).
+  Output is collected in a small fixed buffer and sent as one chunk when full, so
+  memory use doesn't depend on the response size:
+
+    ChunkedResponse<WebServerClass> out(server);
+    out.begin(200, "application/json");
+    out.print("[");
+    ...
+    out.end();
+*/
+template <typename Server>
+class ChunkedResponse : public Print {
+public:
+  explicit ChunkedResponse(Server &server) : m_server(server) {}
+  ~ChunkedResponse() { end(); }
+
+  void begin(int code, const char *contentType) {
+    m_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    m_server.send(code, contentType, "");
+    m_started = true;
+  }
+
+  size_t write(uint8_t c) override {
+    if (m_len == sizeof(m_buf)) {
+      flush();
+    }
+    m_buf[m_len++] = c;
+    return 1;
+  }
+
+  size_t write(const uint8_t *data, size_t size) override {
+    if (size >= sizeof(m_buf)) {
+      // Large block (e.g. file content): one chunk, without copying it
+      flush();
+      if (m_started) {
+        m_server.sendContent((const char *)data, size);
+      }
+      return size;
+    }
+    size_t left = size;
+    while (left) {
+      if (m_len == sizeof(m_buf)) {
+        flush();
+      }
+      size_t n = sizeof(m_buf) - m_len;
+      n = n < left ? n : left;
+      memcpy(m_buf + m_len, data, n);
+      m_len += n;
+      data += n;
+      left -= n;
+    }
+    return size;
+  }
+
+  void flush() override {
+    if (m_len && m_started) {
+      m_server.sendContent((const char *)m_buf, m_len);
+    }
+    m_len = 0;
+  }
+
+  /*
+    Send the buffered data and the terminating empty chunk
+  */
+  void end() {
+    if (!m_started) {
+      return;
+    }
+    flush();
+    m_server.sendContent("");
+    m_started = false;
+  }
+
+  /*
+    Write str as a quoted JSON string, escaping quotes, backslashes and control characters
+  */
+  void printJsonString(const char *str) {
+    write('"');
+    for (const char *p = str; *p; ++p) {
+      unsigned char c = (unsigned char)*p;
+      if (c == '"' || c == '\\') {
+        write('\\');
+        write(c);
+      }
+      else if (c < 0x20) {
+        char esc[8];
+        snprintf(esc, sizeof(esc), "\\u%04x", c);
+        print(esc);
+      }
+      else {
+        write(c);
+      }
+    }
+    write('"');
+  }
+
+private:
+  Server &m_server;
+  uint8_t m_buf[ESP_FS_WS_CHUNK_BUFFER];
+  size_t m_len = 0;
+  bool m_started = false;
+};
+
+#endif
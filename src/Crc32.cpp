@@ -0,0 +1,37 @@
+#include "Crc32.h"
+
+#if defined(ESP32)
+#include <esp_rom_crc.h>
+#endif
+
+namespace Crc32 {
+
+#if defined(ESP32)
+
+uint32_t update(uint32_t crc, const void *data, size_t length) {
+    // Table driven implementation in ROM
+    return esp_rom_crc32_le(crc, (const uint8_t *)data, length);
+}
+
+#else
+
+// Half-byte table: 64 bytes of RAM instead of the 1 KB of the byte-wise table
+static const uint32_t s_table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+uint32_t update(uint32_t crc, const void *data, size_t length) {
+    const uint8_t *p = (const uint8_t *)data;
+    crc = ~crc;
+    while (length--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ s_table[crc & 0x0F];
+        crc = (crc >> 4) ^ s_table[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+#endif
+
+}  // namespace Crc32
@@ -0,0 +1,19 @@
+#ifndef CRC32_H
+#define CRC32_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Crc32 {
+
+/*
+  Standard CRC-32 (IEEE 802.3, as used by zip, gzip and PNG).
+  Start with crc = 0 and feed the data in any number of pieces:
+    uint32_t crc = Crc32::update(0, part1, len1);
+    crc = Crc32::update(crc, part2, len2);
+*/
+uint32_t update(uint32_t crc, const void *data, size_t length);
+
+}  // namespace Crc32
+
+#endif
@@ -0,0 +1,115 @@
+#include "DeleteJob.h"
+#include "SerialLog.h"
+
+bool DeleteJob::begin(fs::FS &fs, const String &path, uint32_t id) {
+    clear();
+    m_fs = &fs;
+    m_id = id;
+    m_path = path;
+    while (m_path.length() > 1 && m_path.endsWith("/")) {
+        m_path.remove(m_path.length() - 1);
+    }
+
+    File file = fs.open(m_path, "r");
+    if (!file) {
+        return false;
+    }
+    bool isDir = file.isDirectory();
+    file.close();
+    if (!isDir) {
+        bool ok = fs.remove(m_path);
+        m_files = ok ? 1 : 0;
+        m_state = ok ? DONE : FAILED;
+        return true;
+    }
+
+    m_root = m_path;
+    m_state = m_walker.begin(fs, m_root) ? RUNNING : FAILED;
+    return true;
+}
+
+bool DeleteJob::run(uint32_t budgetMs) {
+    uint32_t start = millis();
+    while (m_state == RUNNING) {
+        step();
+        if (millis() - start >= budgetMs) {
+            break;
+        }
+    }
+    return m_state == RUNNING;
+}
+
+void DeleteJob::step() {
+    File file;
+    String name;
+    uint8_t depth = m_walker.depth();
+    switch (m_walker.next(file, name)) {
+        case DirWalker::FILE_ENTRY:
+            file.close();
+            if (m_fs->remove(m_walker.fullPath(name))) {
+                m_files++;
+                m_removed = true;
+            }
+            break;
+
+        case DirWalker::DIR:
+            if (m_walker.depth() == depth) {
+                // Not entered: too deep for this walk
+                m_deep = m_walker.fullPath(name);
+            }
+            break;
+
+        case DirWalker::DIR_DONE:
+            if (m_fs->rmdir(m_walker.fullPath(name))) {
+                m_dirs++;
+                m_removed = true;
+            }
+            break;
+
+        case DirWalker::END:
+            if (m_fs->rmdir(m_root)) {
+                m_dirs++;
+                m_removed = true;
+            }
+            nextPass();
+            break;
+    }
+}
+
+void DeleteJob::nextPass() {
+    if (!m_fs->exists(m_path)) {
+        log_debug("Deleted %s: %u files, %u folders", m_path.c_str(), (unsigned)m_files, (unsigned)m_dirs);
+        m_state = DONE;
+        return;
+    }
+    if (!m_deep.isEmpty()) {
+        m_root = m_deep;
+        m_deep = "";
+    }
+    else if (m_removed) {
+        m_root = m_path;
+    }
+    else {
+        // A whole walk without progress: something can't be removed
+        log_error("Delete of %s failed", m_path.c_str());
+        m_state = FAILED;
+        return;
+    }
+    m_removed = false;
+    if (!m_walker.begin(*m_fs, m_root)) {
+        m_state = FAILED;
+    }
+}
+
+void DeleteJob::clear() {
+    m_walker.end();
+    m_fs = nullptr;
+    m_path = "";
+    m_root = "";
+    m_deep = "";
+    m_id = 0;
+    m_files = 0;
+    m_dirs = 0;
+    m_removed = false;
+    m_state = IDLE;
+}
@@ -0,0 +1,74 @@
+#ifndef DELETE_JOB_H
+#define DELETE_JOB_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "DirWalker.h"
+
+// Folder deletions (DELETE /edit) queued at the same time
+#ifndef ESP_FS_WS_DELETE_JOBS
+#define ESP_FS_WS_DELETE_JOBS 4
+#endif
+
+// Milliseconds of deletion work done in each run() call
+#ifndef ESP_FS_WS_DELETE_BUDGET
+#define ESP_FS_WS_DELETE_BUDGET 20
+#endif
+
+/*
+  Recursive delete of a file or folder, without recursion: the folder stack is the one of
+  a DirWalker, so a deletion can be spread over several run() calls:
+
+    DeleteJob job;
+    job.begin(fs, "/logs", id);
+    while (job.run(20)) {
+      ...   // other work between two slices of at most 20 ms
+    }
+
+  Files are removed as they are found, folders once their content is gone. Folders deeper
+  than ESP_FS_WS_LIST_MAX_DEPTH are walked on their own, and the tree is walked again until
+  it is empty (entries removed while a folder is being read can be skipped by the filesystem).
+*/
+class DeleteJob {
+public:
+  enum State : uint8_t { IDLE = 0, RUNNING, DONE, FAILED };
+
+  /*
+    Start deleting path. Returns false if path doesn't exist
+  */
+  bool begin(fs::FS &fs, const String &path, uint32_t id = 0);
+
+  /*
+    Delete entries for about budgetMs. Returns true while there is work left
+  */
+  bool run(uint32_t budgetMs);
+
+  /*
+    Stop and free the slot (what is already deleted stays deleted)
+  */
+  void clear();
+
+  inline State state() const { return m_state; }
+  inline bool active() const { return m_state == RUNNING; }
+  inline uint32_t id() const { return m_id; }
+  inline const String &path() const { return m_path; }
+  inline size_t files() const { return m_files; }
+  inline size_t dirs() const { return m_dirs; }
+
+private:
+  void step();
+  void nextPass();
+
+  fs::FS *m_fs = nullptr;
+  DirWalker m_walker;
+  String m_path;
+  String m_root;          // Folder of the current walk (m_path or a folder too deep for it)
+  String m_deep;          // Folder found beyond the walker depth, walked next
+  uint32_t m_id = 0;
+  size_t m_files = 0;
+  size_t m_dirs = 0;
+  bool m_removed = false; // Something was removed in the current walk
+  State m_state = IDLE;
+};
+
+#endif
@@ -0,0 +1,74 @@
+#include "DirWalker.h"
+
+bool DirWalker::begin(fs::FS &fs, const String &dir, bool recursive, uint8_t maxDepth) {
+    end();
+    m_root = dir.endsWith("/") ? dir : dir + "/";
+    m_maxDepth = recursive ? (maxDepth < ESP_FS_WS_LIST_MAX_DEPTH ? maxDepth : ESP_FS_WS_LIST_MAX_DEPTH) : 1;
+    m_depth = 0;
+    m_names[0] = "";
+    m_dirs[0] = fs.open(dir, "r");
+    if (!m_dirs[0] || !m_dirs[0].isDirectory()) {
+        m_dirs[0].close();
+        return false;
+    }
+    m_open = true;
+    return true;
+}
+
+DirWalker::Kind DirWalker::next(File &file, String &name) {
+    while (m_open) {
+        file = m_dirs[m_depth].openNextFile();
+        if (!file) {
+            // Folder done: back to the parent
+            m_dirs[m_depth].close();
+            if (m_depth == 0) {
+                m_open = false;
+                return END;
+            }
+            file = File();
+            name = m_names[m_depth];
+            m_depth--;
+            return DIR_DONE;
+        }
+
+        // Relative to the root: works for real folders and for flat filesystems (SPIFFS)
+        // that return names containing '/'
+#if defined(ESP32)
+        const char *path = file.path();
+#else
+        const char *path = file.fullName();
+#endif
+        if (path && strncmp(path, m_root.c_str(), m_root.length()) == 0) {
+            name = path + m_root.length();
+        }
+        else {
+            // Names relative to the parent folder only (older cores)
+            name = m_names[m_depth];
+            name += m_depth ? "/" : "";
+            const char *base = strrchr(file.name(), '/');
+            name += base ? base + 1 : file.name();
+        }
+
+        if (file.isDirectory()) {
+            if (m_depth + 1 < m_maxDepth) {
+                m_dirs[++m_depth] = file;
+                m_names[m_depth] = name;
+            }
+            return DIR;
+        }
+        return FILE_ENTRY;
+    }
+    return END;
+}
+
+void DirWalker::end() {
+    for (uint8_t i = 0; i <= m_depth && i < ESP_FS_WS_LIST_MAX_DEPTH; i++) {
+        m_dirs[i].close();
+    }
+    m_depth = 0;
+    m_open = false;
+}
+
+String DirWalker::fullPath(const String &name) const {
+    return m_root + name;
+}
@@ -0,0 +1,67 @@
+#ifndef DIR_WALKER_H
+#define DIR_WALKER_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+// Max folder depth of recursive walks (/list?recursive=1, /archive, ...): one open directory handle per level
+#ifndef ESP_FS_WS_LIST_MAX_DEPTH
+#define ESP_FS_WS_LIST_MAX_DEPTH 6
+#endif
+
+/*
+  Iterative directory walk, without recursion and with a fixed number of open handles.
+  The state lives in the object, so a walk can be spread over several loop() calls:
+
+    DirWalker walker;
+    walker.begin(fs, "/logs");
+    File file;
+    String name;
+    while (DirWalker::Kind kind = walker.next(file, name)) {
+      ...   // name is relative to "/logs", e.g. "2024/01/log.csv"
+    }
+
+  Folders are reported before their content (DIR) and, when their content was walked,
+  once more after it (DIR_DONE), e.g. to remove them once empty. Folders deeper than
+  maxDepth are reported but not entered.
+*/
+class DirWalker {
+public:
+  enum Kind : uint8_t { END = 0, FILE_ENTRY, DIR, DIR_DONE };
+
+  ~DirWalker() { end(); }
+
+  /*
+    Start walking dir. Returns false if dir is not a folder
+  */
+  bool begin(fs::FS &fs, const String &dir, bool recursive = true, uint8_t maxDepth = ESP_FS_WS_LIST_MAX_DEPTH);
+
+  /*
+    Next entry. For FILE_ENTRY and DIR file is the open entry, for DIR_DONE it is empty.
+    Handles are released when file is reassigned: don't close or read a DIR handle,
+    the walker may be iterating it. Returns END when done
+  */
+  Kind next(File &file, String &name);
+
+  /*
+    Stop the walk and close the open handles
+  */
+  void end();
+
+  /*
+    Full path of a relative name returned by next()
+  */
+  String fullPath(const String &name) const;
+
+  inline uint8_t depth() const { return m_depth; }
+
+private:
+  File m_dirs[ESP_FS_WS_LIST_MAX_DEPTH];
+  String m_names[ESP_FS_WS_LIST_MAX_DEPTH];   // Relative names of the open folders
+  String m_root;
+  uint8_t m_depth = 0;
+  uint8_t m_maxDepth = 0;
+  bool m_open = false;
+};
+
+#endif
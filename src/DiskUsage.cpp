@@ -0,0 +1,152 @@
+#include "DiskUsage.h"
+#include "SerialLog.h"
+
+static String normalizeDir(const String &dir) {
+    String path = dir.startsWith("/") ? dir : "/" + dir;
+    while (path.length() > 1 && path.endsWith("/")) {
+        path.remove(path.length() - 1);
+    }
+    return path;
+}
+
+bool DiskUsage::begin(fs::FS &fs, const String &dir, uint8_t depth) {
+    m_fs = &fs;
+    m_dir = normalizeDir(dir);
+    m_depth = depth;
+    restart();
+    return m_state == RUNNING;
+}
+
+void DiskUsage::restart() {
+    m_folders.clear();
+    m_pending.clear();
+    m_prefix = "";
+    for (uint8_t i = 0; i < m_topCount; i++) {
+        m_top[i].path = "";
+    }
+    m_topCount = 0;
+    m_bytes = 0;
+    m_files = 0;
+    m_dirty = false;
+    m_state = m_walker.begin(*m_fs, m_dir) ? RUNNING : IDLE;
+}
+
+bool DiskUsage::run(uint32_t budgetMs) {
+    uint32_t start = millis();
+    while (m_state == RUNNING) {
+        File file;
+        String name;
+        uint8_t depth = m_walker.depth();
+        switch (m_walker.next(file, name)) {
+            case DirWalker::FILE_ENTRY:
+                addFile(m_prefix + name, file.size());
+                break;
+
+            case DirWalker::DIR:
+                name = m_prefix + name;
+                if (m_walker.depth() == depth) {
+                    // Not entered: too deep for this walk
+                    m_pending.push_back(name);
+                }
+                addFolder(name, 0, 0);
+                break;
+
+            case DirWalker::DIR_DONE:
+                break;
+
+            case DirWalker::END:
+                if (m_pending.empty()) {
+                    log_debug("Disk usage of %s: %u files, %u folders", m_dir.c_str(), (unsigned)m_files,
+                              (unsigned)m_folders.size());
+                    m_doneAt = millis();
+                    m_state = DONE;
+                    break;
+                }
+                name = m_pending.back();
+                m_pending.pop_back();
+                m_prefix = name + "/";
+                if (!m_walker.begin(*m_fs, m_dir == "/" ? m_dir + name : m_dir + "/" + name)) {
+                    log_error("Disk usage: can't open %s", name.c_str());
+                }
+                break;
+        }
+        if (millis() - start >= budgetMs) {
+            break;
+        }
+    }
+    return m_state == RUNNING;
+}
+
+void DiskUsage::addFolder(const String &name, uint64_t bytes, uint32_t files) {
+    uint8_t level = 1;
+    for (const char *p = name.c_str(); *p; p++) {
+        level += *p == '/';
+    }
+    if (level > m_depth) {
+        return;
+    }
+    // Backwards: files come right after their folder
+    for (size_t i = m_folders.size(); i > 0; i--) {
+        Folder &folder = m_folders[i - 1];
+        if (folder.path == name) {
+            folder.bytes += bytes;
+            folder.files += files;
+            return;
+        }
+    }
+    m_folders.push_back({name, bytes, files});
+}
+
+void DiskUsage::addFile(const String &name, uint32_t size) {
+    m_bytes += size;
+    m_files++;
+
+    // Every ancestor folder down to m_depth levels
+    int slash = -1;
+    for (uint8_t level = 0; level < m_depth; level++) {
+        slash = name.indexOf('/', slash + 1);
+        if (slash < 0) {
+            break;
+        }
+        addFolder(name.substring(0, slash), size, 1);
+    }
+
+    if (m_topCount == ESP_FS_WS_DU_TOP && size <= m_top[ESP_FS_WS_DU_TOP - 1].size) {
+        return;
+    }
+    uint8_t i = m_topCount < ESP_FS_WS_DU_TOP ? m_topCount++ : ESP_FS_WS_DU_TOP - 1;
+    while (i > 0 && m_top[i - 1].size < size) {
+        m_top[i] = m_top[i - 1];
+        i--;
+    }
+    m_top[i].path = name;
+    m_top[i].size = size;
+}
+
+void DiskUsage::invalidate(const String &path) {
+    if (m_state != RUNNING && m_state != DONE) {
+        return;
+    }
+    bool inside = path.isEmpty() || m_dir == "/" || path == m_dir || path.startsWith(m_dir + "/") ||
+                  m_dir.startsWith(path.endsWith("/") ? path : path + "/");
+    if (!inside) {
+        return;
+    }
+    if (m_state == RUNNING) {
+        // Finished anyway: restarting on every change, a busy folder would never get a result
+        m_dirty = true;
+    }
+    else {
+        m_state = STALE;
+    }
+}
+
+bool DiskUsage::matches(const String &dir, uint8_t depth) const {
+    if (m_state != RUNNING && m_state != DONE) {
+        return false;
+    }
+    if (m_state == DONE && ESP_FS_WS_DU_MAX_AGE && age() > ESP_FS_WS_DU_MAX_AGE) {
+        return false;
+    }
+    return m_depth == depth && m_dir == normalizeDir(dir);
+}
@@ -0,0 +1,109 @@
+#ifndef DISK_USAGE_H
+#define DISK_USAGE_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <vector>
+#include "DirWalker.h"
+
+// Largest files reported by /du
+#ifndef ESP_FS_WS_DU_TOP
+#define ESP_FS_WS_DU_TOP 10
+#endif
+
+// Milliseconds of walk done in each run() call (and in the request that starts it)
+#ifndef ESP_FS_WS_DU_BUDGET
+#define ESP_FS_WS_DU_BUDGET 20
+#endif
+
+// A result older than this (ms) is computed again: changes made without notifyFsChange() are not seen (0 = never)
+#ifndef ESP_FS_WS_DU_MAX_AGE
+#define ESP_FS_WS_DU_MAX_AGE 300000
+#endif
+
+/*
+  Disk usage of a folder: total size and file count, the same per subfolder down to depth
+  levels (each including its own subfolders) and the largest files.
+  The tree is walked a slice at a time with run(); the result is kept until invalidate()
+  is called with a path inside the folder, so asking again costs nothing:
+
+    DiskUsage du;
+    du.begin(fs, "/", 1);
+    while (du.run(20)) {
+      ...
+    }
+    for (const DiskUsage::Folder &folder : du.folders()) ...
+
+  Folders deeper than ESP_FS_WS_LIST_MAX_DEPTH are walked on their own, so nothing is missed.
+*/
+class DiskUsage {
+public:
+  enum State : uint8_t { IDLE = 0, RUNNING, DONE, STALE };
+
+  struct Folder {
+    String path;            // Relative to dir
+    uint64_t bytes;
+    uint32_t files;
+  };
+
+  struct FileInfo {
+    String path;            // Relative to dir
+    uint32_t size;
+  };
+
+  /*
+    Start walking dir. Returns false if dir is not a folder
+  */
+  bool begin(fs::FS &fs, const String &dir, uint8_t depth);
+
+  /*
+    Walk for about budgetMs. Returns true while there is work left. A walk invalidated
+    while running starts again
+  */
+  bool run(uint32_t budgetMs);
+
+  /*
+    Mark the result as outdated if path is inside the walked folder (or contains it).
+    "" means any path. A walk in progress is not restarted: it completes and is marked
+    dirty (it may miss that change), to be computed again after it is used
+  */
+  void invalidate(const String &path);
+
+  /*
+    True if the result (or the walk in progress) is about dir and depth and still valid
+  */
+  bool matches(const String &dir, uint8_t depth) const;
+
+  inline State state() const { return m_state; }
+  inline const String &dir() const { return m_dir; }
+  inline uint8_t depth() const { return m_depth; }
+  inline uint64_t bytes() const { return m_bytes; }
+  inline uint32_t files() const { return m_files; }
+  inline const std::vector<Folder> &folders() const { return m_folders; }
+  inline const FileInfo *top() const { return m_top; }
+  inline uint8_t topCount() const { return m_topCount; }
+  inline uint32_t age() const { return m_state == DONE ? millis() - m_doneAt : 0; }
+  inline bool dirty() const { return m_dirty; }
+
+private:
+  void restart();
+  void addFolder(const String &name, uint64_t bytes, uint32_t files);
+  void addFile(const String &name, uint32_t size);
+
+  fs::FS *m_fs = nullptr;
+  DirWalker m_walker;
+  String m_dir;
+  String m_prefix;                  // Relative path of the folder being walked ("" for dir)
+  std::vector<String> m_pending;    // Folders too deep for the walker, walked next
+  std::vector<Folder> m_folders;
+  FileInfo m_top[ESP_FS_WS_DU_TOP]; // Largest first
+  uint8_t m_topCount = 0;
+  uint8_t m_depth = 1;
+  uint64_t m_bytes = 0;
+  uint32_t m_files = 0;
+  uint32_t m_doneAt = 0;
+  bool m_dirty = false;             // Changed while walking
+  State m_state = IDLE;
+};
+
+#endif
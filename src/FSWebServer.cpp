@@ -1,8 +1,5 @@
 #include "FSWebServer.h"
 
-#if defined(ESP32)
-    #include "mimetable/mimetable.h"
-#endif
 
 namespace {
 String serializeJsonDocument(cJSON *root) {
@@ -18,6 +15,18 @@ String serializeJsonDocument(cJSON *root) {
     cJSON_Delete(root);
     return out;
 }
+
+// Request headers the library needs for conditional and ranged responses
+const char *s_collectedHeaders[] = {"If-None-Match", "If-Modified-Since", "Range", "If-Range", "Accept-Encoding", "Content-Type"};
+
+// ETags of the built-in PROGMEM pages, computed at compile time
+#if ESP_FS_WS_SETUP
+constexpr uint32_t SETUP_HTM_HASH = HttpUtils::fnv1a32(_acsetup_min_htm);
+constexpr uint32_t LOGO_SVG_HASH = HttpUtils::fnv1a32(_aclogo_svg);
+#endif
+#if ESP_FS_WS_EDIT
+constexpr uint32_t EDIT_HTM_HASH = HttpUtils::fnv1a32(_acedit_htm);
+#endif
 }
 
 
@@ -27,6 +36,9 @@ void FSWebServer::begin(WebSocketsServer::WebSocketServerEvent wsEventHandler) {
     if (m_version.length() == 0)
         m_version = String(BUILD_TIMESTAMP);
 
+    // Random start value, so ETags based on it don't collide across reboots
+    m_fsGeneration = static_cast<uint32_t>(random(0x7FFFFFFF));
+
 //////////////////////    BUILT-IN HANDLERS    ///////////////////////////
 #if ESP_FS_WS_SETUP
     ConfigUpgrader upgrader(m_filesystem, ESP_FS_WS_CONFIG_FILE);
@@ -41,6 +53,7 @@ void FSWebServer::begin(WebSocketsServer::WebSocketServerEvent wsEventHandler) {
     if (!m_filesystem_ok) {
         log_error("Filesystem not available. Setup page will not work.");
     }
+    loadCacheRules();
 
     // Close config file if it was opened during setup (will be reopened on demand when accessing config options)
     if (getSetupConfigurator()->isOpened()) {
@@ -67,6 +80,7 @@ void FSWebServer::begin(WebSocketsServer::WebSocketServerEvent wsEventHandler) {
     on("/", HTTP_GET, [this]() { this->handleIndex(); });
     on("/setup", HTTP_GET, [this]() { this->handleSetup(); });
     on("/update", HTTP_POST, [this]() {this->update_second();}, [this]() { this->update_first();});
+    on("/update", HTTP_PUT, [this]() {this->update_second();}, [this]() { this->update_raw();});
     onNotFound([this]() { this->handleFileRequest(); });
 
     // Serve default logo from PROGMEM when no custom logo exists on filesystem
@@ -77,8 +91,11 @@ void FSWebServer::begin(WebSocketsServer::WebSocketServerEvent wsEventHandler) {
             !m_filesystem->exists(logoBase + ".png") &&
             !m_filesystem->exists(logoBase + ".jpg") &&
             !m_filesystem->exists(logoBase + ".gif")) {
+                if (this->checkNotModified(HttpUtils::makeEtag(LOGO_SVG_HASH), 0,
+                                           m_cachePolicy.lookup(this->uri(), "public, max-age=86400"))) {
+                    return;
+                }
                 this->sendHeader(PSTR("Content-Encoding"), "gzip");
-                this->sendHeader(PSTR("Cache-Control"), "public, max-age=86400");
                 this->send_P(200, "image/svg+xml", (const char*)_aclogo_svg, sizeof(_aclogo_svg));
         } else {
            this->handleFileRequest();
@@ -98,7 +115,33 @@ void FSWebServer::begin(WebSocketsServer::WebSocketServerEvent wsEventHandler) {
     if (wsEventHandler) {
         m_websocket = new WebSocketsServer(m_port + 1);
         m_websocket->begin();
+#if defined(ESP32) && ESP_FS_WS_SERVER_TASK
+        // While the server task runs, events are also queued for dispatchEvents()
+        m_websocket->onEvent([this, wsEventHandler](uint8_t num, WStype_t type, uint8_t *payload, size_t length) {
+            wsEventHandler(num, type, payload, length);
+            if (!m_serverTask) {
+                return;
+            }
+            switch (type) {
+                case WStype_CONNECTED:
+                    postEvent(num, nullptr, 0, ServerEventType::WsConnected);
+                    break;
+                case WStype_DISCONNECTED:
+                    postEvent(num, nullptr, 0, ServerEventType::WsDisconnected);
+                    break;
+                case WStype_TEXT:
+                    postEvent(num, payload, length, ServerEventType::WsText);
+                    break;
+                case WStype_BIN:
+                    postEvent(num, payload, length, ServerEventType::WsBinary);
+                    break;
+                default:
+                    break;
+            }
+        });
+#else
         m_websocket->onEvent(wsEventHandler);
+#endif
         log_debug("WebSocket server started on port %u", m_port + 1);
     }
 #endif
@@ -106,6 +149,7 @@ void FSWebServer::begin(WebSocketsServer::WebSocketServerEvent wsEventHandler) {
 #ifdef ESP32
     this->enableCrossOrigin(true);    
 #endif
+    this->collectHeaders(s_collectedHeaders, sizeof(s_collectedHeaders) / sizeof(s_collectedHeaders[0]));
     WebServerClass::begin(m_port);
     log_debug("HTTP server started on port %u", m_port);
     
@@ -150,6 +194,7 @@ void FSWebServer::handleSetupWebSocket(uint8_t clientId, WStype_t type, uint8_t
             handleSetupWebSocketMessage(clientId, payload, length);
             break;
         case WStype_DISCONNECTED:
+            m_fsSubscribers &= ~(1UL << clientId);
             if (m_setupWebSocket && m_setupWebSocket->connectedClients() == 0) {
                 m_releaseSetupWebSocketPending = true;
             }
@@ -271,6 +316,28 @@ void FSWebServer::handleSetupWebSocketMessage(uint8_t clientId, const uint8_t *d
         return;
     }
 
+    if (nameStr == "fs.subscribe") {
+        // Changes after "since" now, then an "fs.change" event for every new one
+        uint32_t since = 0;
+        cJSON *sinceNode = cJSON_IsObject(payload) ? cJSON_GetObjectItemCaseSensitive(payload, "since") : nullptr;
+        if (cJSON_IsNumber(sinceNode) && sinceNode->valuedouble > 0) {
+            since = (uint32_t)sinceNode->valuedouble;
+        }
+        cJSON_Delete(root);
+        if (clientId < 32) {
+            m_fsSubscribers |= 1UL << clientId;
+        }
+        sendSetupWsResponse(clientId, reqIdStr, true, nameStr.c_str(), buildFsChangesPayload(since));
+        return;
+    }
+
+    if (nameStr == "fs.unsubscribe") {
+        cJSON_Delete(root);
+        m_fsSubscribers &= ~(1UL << clientId);
+        sendSetupWsResponse(clientId, reqIdStr, true, nameStr.c_str());
+        return;
+    }
+
     if (nameStr == "device.restart") {
         cJSON_Delete(root);
         sendSetupWsResponse(clientId, reqIdStr, true, nameStr.c_str());
@@ -390,7 +457,11 @@ void FSWebServer::sendSetupWsResponse(uint8_t clientId, const String &reqId, boo
 }
 
 void FSWebServer::sendSetupWsEvent(uint8_t clientId, const char *name, const String &payload) {
-    if (!m_setupWebSocket || !m_setupWebSocket->clientIsConnected(clientId)) {
+    bool broadcast = clientId == SETUP_WS_BROADCAST;
+    if (!m_setupWebSocket) {
+        return;
+    }
+    if (broadcast ? m_setupWebSocket->connectedClients() == 0 : !m_setupWebSocket->clientIsConnected(clientId)) {
         return;
     }
 
@@ -405,6 +476,10 @@ void FSWebServer::sendSetupWsEvent(uint8_t clientId, const char *name, const Str
     }
 
     String message = serializeJsonDocument(root);
+    if (broadcast) {
+        m_setupWebSocket->broadcastTXT(message.c_str(), message.length());
+        return;
+    }
     m_setupWebSocket->sendTXT(clientId, message.c_str(), message.length());
 }
 
@@ -505,10 +580,12 @@ bool FSWebServer::saveSetupConfigJson(const String &jsonText) {
 
     size_t written = file.print(jsonText);
     file.close();
+    fsChanged(ESP_FS_WS_CONFIG_FILE);
     if (written == 0) {
         return false;
     }
 
+    loadCacheRules();
     if (m_configSavedCallback) {
         m_configSavedCallback(ESP_FS_WS_CONFIG_FILE);
     }
@@ -577,17 +654,14 @@ void FSWebServer::processPendingSetupWifiConnection() {
 
 void FSWebServer::handleIndex(){
     log_debug("handleIndex");
-    if (m_filesystem->exists("/index.htm")) {
-        File dataFile = m_filesystem->open("/index.htm", "r");
-        this->streamFile(dataFile, "text/html");
-        dataFile.close();
-        log_debug("Serving /index.htm");
-    } 
-    else if (m_filesystem->exists("/index.html")) {
-        File dataFile = m_filesystem->open("/index.html", "r");
-        this->streamFile(dataFile, "text/html");
-        dataFile.close();
-        log_debug("Serving /index.html");
+    if (serveRomFile("/")) {
+        return;
+    }
+    FileCacheEntry &htm = resolveFile("/index.htm");
+    FileCacheEntry &index = htm.found ? htm : resolveFile("/index.html");
+    if (index.found) {
+        log_debug("Serving %s", index.url.c_str());
+        serveFile(index);
     }
 
     #if ESP_FS_WS_SETUP 
@@ -648,13 +722,37 @@ void FSWebServer::printFileList(fs::FS &fs, const char * dirname, uint8_t levels
 void FSWebServer::enableFsCodeEditor() {
     on("/status", HTTP_GET, [this]() { this->handleFsStatus(); });
     on("/list", HTTP_GET, [this]() { this->handleFileList(); });
+    on("/archive", HTTP_GET, [this]() { this->handleArchive(); });
+    on("/extract", HTTP_POST,
+        [this]() { this->handleExtractDone(); },
+        [this]() { this->handleExtract(); }
+    );
+    on("/search", HTTP_GET, [this]() { this->handleSearch(); });
+    on("/changes", HTTP_GET, [this]() { this->handleChanges(); });
+    on("/du", HTTP_GET, [this]() { this->handleDiskUsage(); });
+    on("/sync/manifest", HTTP_GET, [this]() { this->handleSyncManifest(); });
+    on("/sync/apply", HTTP_POST,
+        [this]() { this->handleExtractDone(true); },
+        [this]() { this->handleExtract(); }
+    );
+    on("/batch", HTTP_POST, [this]() { this->handleBatch(); });
     on("/edit", HTTP_PUT, [this]() { this->handleFileCreate(); });
     on("/edit", HTTP_GET, [this]() { this->handleFileEdit(); });
     on("/edit", HTTP_DELETE, [this]() { this->handleFileDelete(); });
     on("/edit", HTTP_POST,
-        [this]() { this->sendOK(); },
+        [this]() { this->handleFileUploadDone(); },
         [this]() { this->handleFileUpload(); }
     );
+#if ESP_FS_WS_UPLOAD_SESSIONS
+    on("/upload", HTTP_POST, [this]() { this->handleUploadStart(); });
+    on("/upload", HTTP_GET, [this]() { this->handleUploadStatus(); });
+    on("/upload", HTTP_DELETE, [this]() { this->handleUploadAbort(); });
+    on("/upload", HTTP_PUT,
+        [this]() { this->handleUploadChunkDone(); },
+        [this]() { this->handleUploadChunk(); }
+    );
+    on("/upload/commit", HTTP_POST, [this]() { this->handleUploadCommit(); });
+#endif
 }
 #endif
 
@@ -713,6 +811,406 @@ void FSWebServer::sendOK() {
 }
 
 
+// Resolve a decoded URL to the stored representations (plain file, ".gz" and ".br" variants).
+// Results, including misses, are kept in m_fileCache to skip the exists() walks
+FileCacheEntry &FSWebServer::resolveFile(const String &url) {
+    FileCacheEntry *cached = m_fileCache.find(url);
+    if (cached) {
+        return *cached;
+    }
+
+    FileCacheEntry &entry = m_fileCache.insert(url);
+    entry.contentType = mimetype::getContentType(url);
+
+    for (uint8_t enc = ENCODING_IDENTITY; enc < ENCODING_COUNT; enc++) {
+        entry.variants[enc].exists = m_filesystem->exists(entry.path((FileEncoding)enc));
+        entry.found |= entry.variants[enc].exists;
+    }
+    // A direct request of gzip data with a non-gzip content type (e.g. "logo.svg.gz")
+    entry.identityGzip = url.endsWith(".gz") && strcmp_P("application/x-gzip", entry.contentType) != 0 &&
+                         strcmp_P("application/octet-stream", entry.contentType) != 0;
+    log_debug("Resolved %s: identity %d, gz %d, br %d", url.c_str(), entry.variants[ENCODING_IDENTITY].exists,
+              entry.variants[ENCODING_GZIP].exists, entry.variants[ENCODING_BROTLI].exists);
+    return entry;
+}
+
+// Pick the stored representation to send, based on the client Accept-Encoding header
+FileEncoding FSWebServer::negotiateEncoding(const FileCacheEntry &entry) {
+    String accept = this->header("Accept-Encoding");
+    if (entry.variants[ENCODING_BROTLI].exists && HttpUtils::acceptsEncoding(accept, "br")) {
+        return ENCODING_BROTLI;
+    }
+    if (entry.variants[ENCODING_GZIP].exists && HttpUtils::acceptsEncoding(accept, "gzip")) {
+        return ENCODING_GZIP;
+    }
+    if (entry.variants[ENCODING_IDENTITY].exists) {
+        return ENCODING_IDENTITY;
+    }
+    // Only compressed copies are stored: send one anyway, as every browser accepts gzip
+    return entry.variants[ENCODING_GZIP].exists ? ENCODING_GZIP : ENCODING_BROTLI;
+}
+
+// (Re)load the Cache-Control rules stored in the "_cache" section of config.json
+void FSWebServer::loadCacheRules() {
+#if ESP_FS_WS_SETUP
+    if (!m_filesystem || !m_filesystem->exists(ESP_FS_WS_CONFIG_FILE)) {
+        m_cachePolicy.clear(true);
+        return;
+    }
+    File file = m_filesystem->open(ESP_FS_WS_CONFIG_FILE, "r");
+    if (!file) {
+        return;
+    }
+    String content = file.readString();
+    file.close();
+
+    CJSON::Json doc;
+    if (!doc.parse(content)) {
+        log_error("Cache rules: failed to parse %s", ESP_FS_WS_CONFIG_FILE);
+        return;
+    }
+    const cJSON *section = cJSON_GetObjectItemCaseSensitive(doc.getRoot(), "_cache");
+    if (m_cachePolicy.load(section)) {
+        log_debug("Cache rules loaded from %s", ESP_FS_WS_CONFIG_FILE);
+    }
+#endif
+}
+
+void FSWebServer::dropFsCaches(const String &path) {
+    m_fileCache.clear();
+    m_fsGeneration++;
+    m_hashCache.invalidate(path);
+#if ESP_FS_WS_EDIT_HTM
+    m_diskUsage.invalidate(path);
+#endif
+}
+
+void FSWebServer::fsChanged(const String &path, FsChangeType type) {
+    dropFsCaches(path);
+    m_retention.changed(path, type);
+#if ESP_FS_WS_CHANGE_JOURNAL
+    if (path.isEmpty()) {
+        return;
+    }
+#if ESP_FS_WS_SETUP
+    const FsChange &change = m_changes.add(path, type);
+    if (m_fsSubscribers) {
+        CJSON::Json doc;
+        doc.setNumber("seq", change.seq);
+        doc.setString("type", ChangeJournal::typeName(change.type));
+        doc.setString("path", change.path);
+        String payload = doc.serialize();
+        for (uint8_t client = 0; client < 32; client++) {
+            if (m_fsSubscribers & (1UL << client)) {
+                sendSetupWsEvent(client, "fs.change", payload);
+            }
+        }
+    }
+#else
+    m_changes.add(path, type);
+#endif
+#endif
+}
+
+/*
+    {"seq":12,"reset":false,"changes":[{"seq":11,"type":"modified","path":"/log.csv"},...]}
+    reset: some changes after since were dropped from the journal (or since is from before
+    a reboot), the client has to reload everything
+*/
+String FSWebServer::buildFsChangesPayload(uint32_t since) const {
+    cJSON *payload = cJSON_CreateObject();
+    cJSON *changes = cJSON_CreateArray();
+    bool complete = m_changes.since(since, [changes](const FsChange &change) {
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddNumberToObject(item, "seq", change.seq);
+        cJSON_AddStringToObject(item, "type", ChangeJournal::typeName(change.type));
+        cJSON_AddStringToObject(item, "path", change.path.c_str());
+        cJSON_AddItemToArray(changes, item);
+    });
+    cJSON_AddNumberToObject(payload, "seq", m_changes.seq());
+    cJSON_AddBoolToObject(payload, "reset", !complete);
+    cJSON_AddItemToObject(payload, "changes", changes);
+    return serializeJsonDocument(payload);
+}
+
+void FSWebServer::notifyFsChange(const String &path, FsChangeType type) {
+    queueFsChanged(path.isEmpty() ? String("/") : path, type);
+}
+
+void FSWebServer::queueFsChanged(const String &path, FsChangeType type) {
+#if defined(ESP32) && ESP_FS_WS_SERVER_TASK
+    if (fromOtherTask()) {
+        if (!postToServer(OUTBOX_FS_CHANGE, type, (const uint8_t *)path.c_str(), path.length())) {
+            log_error("Outbox full, change of %s lost", path.c_str());
+        }
+        return;
+    }
+#endif
+    fsChanged(path, type);
+}
+
+uint64_t FSWebServer::fsFreeBytes() {
+    fsInfo_t info = {0, 0, ""};
+#ifdef ESP8266
+    FSInfo fs_info;
+    m_filesystem->info(fs_info);
+    info.totalBytes = fs_info.totalBytes;
+    info.usedBytes = fs_info.usedBytes;
+#endif
+    if (getFsInfo != nullptr) {
+        getFsInfo(&info);
+    }
+    if (!info.totalBytes) {
+        // Unknown (no info callback): nothing is refused for lack of space
+        return SIZE_MAX;
+    }
+    return info.totalBytes > info.usedBytes ? info.totalBytes - info.usedBytes : 0;
+}
+
+bool FSWebServer::checkNotModified(const String &etag, time_t lastModified, const char *cacheControl) {
+    bool validTime = lastModified >= HttpUtils::MIN_VALID_TIME;
+    this->sendHeader(PSTR("ETag"), etag);
+    if (validTime) {
+        this->sendHeader(PSTR("Last-Modified"), HttpUtils::formatHttpDate(lastModified));
+    }
+    if (cacheControl) {
+        this->sendHeader(PSTR("Cache-Control"), cacheControl);
+    }
+
+    bool notModified = false;
+    // If-None-Match takes precedence over If-Modified-Since (RFC 7232, 6)
+    if (this->hasHeader("If-None-Match")) {
+        notModified = HttpUtils::etagMatches(this->header("If-None-Match"), etag);
+    }
+    else if (validTime && this->hasHeader("If-Modified-Since")) {
+        time_t since = HttpUtils::parseHttpDate(this->header("If-Modified-Since").c_str());
+        notModified = since != 0 && lastModified <= since;
+    }
+
+    if (notModified) {
+        log_debug("%s not modified", this->uri().c_str());
+        this->send(304);
+    }
+    return notModified;
+}
+
+// Stream a resolved file, answering 304 when the client copy is still valid.
+// Once size and mtime are cached, the 304 path doesn't open the file at all
+bool FSWebServer::serveFile(FileCacheEntry &entry) {
+    static const char *const encodingNames[ENCODING_COUNT] = {nullptr, "gzip", "br"};
+    FileEncoding encoding = negotiateEncoding(entry);
+    FileVariant &variant = entry.variants[encoding];
+    const char *contentEncoding = encodingNames[encoding];
+    if (encoding == ENCODING_IDENTITY && entry.identityGzip) {
+        contentEncoding = "gzip";
+    }
+
+    const char *cacheControl = m_cachePolicy.lookup(entry.url);
+    if (entry.hasAlternatives()) {
+        this->sendHeader(PSTR("Vary"), "Accept-Encoding");
+    }
+    if (variant.hasMeta &&
+        checkNotModified(HttpUtils::makeEtag(variant.size, variant.lastWrite, m_fsGeneration, contentEncoding), variant.lastWrite, cacheControl)) {
+        return true;
+    }
+
+    String path = entry.path(encoding);
+    File file = m_filesystem->open(path, "r");
+    if (!file) {
+        // Stale entry (file removed behind our back): resolve again on next request
+        log_debug("Failed to open file %s", path.c_str());
+        fsChanged();
+        this->send(500, "text/plain", "FsWebServer: Failed to open file resource");
+        return false;
+    }
+
+    if (!variant.hasMeta) {
+        variant.size = file.size();
+        variant.lastWrite = file.getLastWrite();
+        variant.hasMeta = true;
+        if (checkNotModified(HttpUtils::makeEtag(variant.size, variant.lastWrite, m_fsGeneration, contentEncoding), variant.lastWrite, cacheControl)) {
+            file.close();
+            return true;
+        }
+    }
+
+    size_t size = file.size();
+    size_t start = 0, length = size;
+    int code = 200;
+    this->sendHeader(PSTR("Accept-Ranges"), "bytes");
+    if (this->hasHeader("Range")) {
+        HttpUtils::RangeResult range = HttpUtils::parseRange(this->header("Range"), size, start, length);
+        // A stale If-Range validator means the client wants the whole, current file
+        if (range != HttpUtils::RangeResult::None && this->hasHeader("If-Range") &&
+            !HttpUtils::ifRangeMatches(this->header("If-Range"),
+                                       HttpUtils::makeEtag(variant.size, variant.lastWrite, m_fsGeneration, contentEncoding),
+                                       variant.lastWrite)) {
+            range = HttpUtils::RangeResult::None;
+        }
+
+        if (range == HttpUtils::RangeResult::Unsatisfiable) {
+            file.close();
+            this->sendHeader(PSTR("Content-Range"), String("bytes */") + size);
+            this->send(416, "text/plain", "");
+            return true;
+        }
+
+        if (range == HttpUtils::RangeResult::Satisfiable) {
+            log_debug("Range %u-%u/%u for %s", start, start + length - 1, size, path.c_str());
+            if (!file.seek(start, SeekSet)) {
+                file.close();
+                this->send(500, "text/plain", "FsWebServer: seek failed");
+                return false;
+            }
+            char contentRange[48];
+            snprintf(contentRange, sizeof(contentRange), "bytes %lu-%lu/%lu",
+                     (unsigned long)start, (unsigned long)(start + length - 1), (unsigned long)size);
+            this->sendHeader(PSTR("Content-Range"), contentRange);
+            code = 206;
+        }
+        else {
+            start = 0;
+            length = size;
+        }
+    }
+
+    if (contentEncoding) {
+        this->sendHeader(PSTR("Content-Encoding"), contentEncoding);
+    }
+    this->setContentLength(length);
+    this->send(code, entry.contentType, "");
+    if (queueTransfer(file, length)) {
+        return true;
+    }
+    sendFileContent(file, length);
+    file.close();
+    return true;
+}
+
+// Hand the response body over to the transfer pool, served from run() in slices.
+// Returns false if the body must be sent right now (small content or no free slot)
+bool FSWebServer::queueTransfer(File &file, size_t length) {
+#if ESP_FS_WS_TRANSFERS
+    if (length > ESP_FS_WS_TRANSFER_SLICE && m_transfers.add(this->client(), file, length)) {
+        // The pool holds its own reference to the connection: let the core move on to the next client
+        _currentClient = decltype(_currentClient)();
+        return true;
+    }
+#endif
+    return false;
+}
+
+// Serve url from the mounted ROMFS image, if present. Data is sent straight from flash.
+// A folder URL ("/" or "/app/") is served with its index.htm / index.html
+bool FSWebServer::serveRomFile(const String &url) {
+    if (!m_romFs.mounted()) {
+        return false;
+    }
+    RomFsEntry entry;
+    String path = url;
+    bool found = false;
+    if (path.endsWith("/")) {
+        found = m_romFs.find((path + "index.htm").c_str(), entry) || m_romFs.find((path + "index.html").c_str(), entry);
+    } else {
+        found = m_romFs.find(path.c_str(), entry);
+    }
+    if (!found) {
+        return false;
+    }
+
+    if (entry.encoding == ROMFS_GZIP) {
+        // No Accept-Encoding at all means any coding is fine
+        if (this->hasHeader("Accept-Encoding") && !HttpUtils::acceptsEncoding(this->header("Accept-Encoding"), "gzip")) {
+            auto plain = [this](const String &file) { return resolveFile(file).variants[ENCODING_IDENTITY].exists; };
+            if (url.endsWith("/") ? plain(url + "index.htm") || plain(url + "index.html") : plain(url)) {
+                // The uncompressed filesystem copy is served instead
+                return false;
+            }
+            this->send(406, "text/plain", "GZIP ONLY");
+            return true;
+        }
+        this->sendHeader(PSTR("Vary"), "Accept-Encoding");
+    }
+
+    if (checkNotModified(HttpUtils::makeEtag(entry.hash), 0, m_cachePolicy.lookup(url))) {
+        return true;
+    }
+
+    const char *data = (const char *)m_romFs.data(entry);
+    size_t start = 0, length = entry.length;
+    int code = 200;
+    this->sendHeader(PSTR("Accept-Ranges"), "bytes");
+    if (this->hasHeader("Range")) {
+        HttpUtils::RangeResult range = HttpUtils::parseRange(this->header("Range"), entry.length, start, length);
+        if (range != HttpUtils::RangeResult::None && this->hasHeader("If-Range") &&
+            !HttpUtils::ifRangeMatches(this->header("If-Range"), HttpUtils::makeEtag(entry.hash), 0)) {
+            range = HttpUtils::RangeResult::None;
+        }
+        if (range == HttpUtils::RangeResult::Unsatisfiable) {
+            this->sendHeader(PSTR("Content-Range"), String("bytes */") + entry.length);
+            this->send(416, "text/plain", "");
+            return true;
+        }
+        if (range == HttpUtils::RangeResult::Satisfiable) {
+            char contentRange[48];
+            snprintf(contentRange, sizeof(contentRange), "bytes %lu-%lu/%lu",
+                     (unsigned long)start, (unsigned long)(start + length - 1), (unsigned long)entry.length);
+            this->sendHeader(PSTR("Content-Range"), contentRange);
+            code = 206;
+        }
+        else {
+            start = 0;
+            length = entry.length;
+        }
+    }
+
+    if (entry.encoding == ROMFS_GZIP) {
+        this->sendHeader(PSTR("Content-Encoding"), "gzip");
+    }
+    this->send_P(code, entry.mime, data + start, length);
+    return true;
+}
+
+// Write the next length bytes of file to the current client
+size_t FSWebServer::sendFileContent(File &file, size_t length) {
+#if defined(ESP32) && ESP_FS_WS_STREAM_TASK
+    // Large files: read the next block in background while the current one is on the wire
+    if (length >= ESP_FS_WS_STREAM_TASK_MIN) {
+        FileStreamer streamer(m_streamBufferSize, m_streamPsram);
+        if (streamer.begin(file, length)) {
+            return streamer.stream(this->client());
+        }
+        // Not enough memory: fall back to the single buffer loop
+    }
+#endif
+    size_t bufSize = length < ESP_FS_WS_STREAM_CHUNK ? length : ESP_FS_WS_STREAM_CHUNK;
+    if (bufSize == 0) {
+        return 0;
+    }
+    uint8_t *buf = (uint8_t *)malloc(bufSize);
+    if (!buf) {
+        log_error("Not enough memory for stream buffer");
+        return 0;
+    }
+
+    size_t sent = 0;
+    while (sent < length) {
+        size_t toRead = length - sent < bufSize ? length - sent : bufSize;
+        size_t len = file.read(buf, toRead);
+        if (len == 0) {
+            break;
+        }
+        size_t written = this->client().write(buf, len);
+        sent += written;
+        if (written != len) {
+            log_debug("Client disconnected after %u bytes", sent);
+            break;
+        }
+    }
+    free(buf);
+    return sent;
+}
+
 // First try to find and return the requested file from the filesystem,
 // and if it fails, return a 404 page with debug information        
 void FSWebServer::handleFileRequest() {
@@ -725,43 +1223,23 @@ void FSWebServer::handleFileRequest() {
             return this->requestAuthentication();
     }
 
-#if defined(ESP8266)
-    // ESP8266WebServer has its own mime namespace
-    using namespace mime;
-    String contentType = getContentType(_url);
-#elif defined(ESP32)
-    // Use local mimetable from library
-    String contentType = mimetype::getContentType(_url);
-#endif
-
-    if (!m_filesystem->exists(_url)) {
-        // Requested file not found, check if gzipped version exists
-        log_debug("File %s not found, checking for gzipped version", this->uri().c_str());
-        _url += ".gz";  
+    // Files embedded in the ROMFS image take precedence over the filesystem
+    if (serveRomFile(_url)) {
+        return;
     }
-    
-    if (m_filesystem->exists(_url)) {
-        File file = m_filesystem->open(_url , "r");
-        if (file) {               
-            this->streamFile(file, contentType);
-            file.close();
-            return; // If file was served, skip the rest
-        } 
-        else {
-            log_debug("Failed to open file %s", _url.c_str());
-            this->send(500, "text/plain", "FsWebServer: Failed to open file resource");
-        } 
+
+    FileCacheEntry &entry = resolveFile(_url);
+    if (entry.found) {
+        serveFile(entry);
+        return; // If file was served, skip the rest
     }
-    else {
-        log_debug("File %s not found, checking for index redirection", this->uri().c_str());
-        
-        // File not found
-        if (this->uri() == "/" && !m_filesystem->exists("/index.htm") && !m_filesystem->exists("/index.html")) {
-            this->sendHeader(PSTR("Location"), "/");
-            this->send(302, "text/plain", "");
-            log_debug("Redirecting \"/\" to \"/setup\" (no index file found)");
-            return;
-        }
+
+    log_debug("File %s not found, checking for index redirection", this->uri().c_str());
+    if (this->uri() == "/" && !resolveFile("/index.htm").found && !resolveFile("/index.html").found) {
+        this->sendHeader(PSTR("Location"), "/");
+        this->send(302, "text/plain", "");
+        log_debug("Redirecting \"/\" to \"/setup\" (no index file found)");
+        return;
     }
 
     this->send(404, "text/plain", "FsWebServer: resource not found");
@@ -776,9 +1254,12 @@ void FSWebServer::handleSetup() {
             return this->requestAuthentication();
     }
     initSetupWebSocket();
-    this->sendHeader(PSTR("Content-Encoding"), "gzip");
     this->sendHeader(PSTR("X-Config-File"), ESP_FS_WS_CONFIG_FILE);
     this->sendHeader(PSTR("Set-Cookie"), "esp_fs_ws_mode=dedicated; Path=/; SameSite=Lax");
+    if (this->checkNotModified(HttpUtils::makeEtag(SETUP_HTM_HASH), 0, m_cachePolicy.lookup("/setup"))) {
+        return;
+    }
+    this->sendHeader(PSTR("Content-Encoding"), "gzip");
     // Changed array name to match SEGGER Bin2C output
     this->send_P(200, "text/html", (const char*)_acsetup_min_htm, sizeof(_acsetup_min_htm));
 }
@@ -830,6 +1311,10 @@ void FSWebServer::checkForUnsupportedPath(String& filename, String& error)
 void FSWebServer::handleFileUpload()
 {
     HTTPUpload& upload = this->upload();
+    WiFiClient &client = this->client();
+    // Every connection has its own context: uploads never share the file or the buffer
+    UploadContext &ctx = m_uploads.acquire(m_filesystem, client.remoteIP(), client.remotePort());
+
     if (upload.status == UPLOAD_FILE_START) {
         String filename = upload.filename;
         String result;
@@ -838,99 +1323,243 @@ void FSWebServer::handleFileUpload()
             filename = "/" + filename;
         }
         checkForUnsupportedPath(filename, result);
-        createDirFromPath(filename);
-
         if (result.length() > 0) {
-            this->send(500, "text/plain", "INVALID FILENAME");
+            ctx.fail(500, "INVALID FILENAME");
             return;
         }
 
         log_debug("handleFileUpload Name: %s\n", filename.c_str());
-        m_uploadFile = m_filesystem->open(filename, "w");
-        if (!m_uploadFile) {
-            this->send(500, "text/plain", "CREATE FAILED");
+        m_uploads.closeFile(ctx);
+        ctx.received = 0;
+        ctx.expected = this->clientContentLength();
+
+        // Admission before anything is truncated: what is left of the body (an upper bound of the
+        // file size) must fit in the free space, plus the space of the file it replaces
+        size_t replaced = 0;
+        File old = m_filesystem->open(filename, "r");
+        bool exists = old && !old.isDirectory();
+        if (exists) {
+            replaced = old.size();
+        }
+        old.close();
+        uint64_t declared = ctx.expected > ctx.done ? ctx.expected - ctx.done : 0;
+        uint64_t reserved = m_uploads.pending(&ctx) + ESP_FS_WS_UPLOAD_MIN_FREE;
+        uint64_t freeBytes = fsFreeBytes();
+        freeBytes = freeBytes > reserved ? freeBytes - reserved : 0;
+        if (declared > freeBytes + replaced) {
+            log_error("Upload of %s refused: %u bytes, %u free", filename.c_str(), (unsigned)declared, (unsigned)freeBytes);
+            ctx.fail(507, "INSUFFICIENT STORAGE");
+            return;
+        }
+
+        // A file replaced is written next to it and renamed at the end when both fit, so a failed
+        // upload leaves it untouched. Only when its space is needed it's overwritten in place
+        ctx.target = "";
+        ctx.path = filename;
+        if (exists && declared <= freeBytes) {
+            ctx.target = filename;
+            ctx.path = filename + ESP_FS_WS_UPLOAD_PART_EXT;
+        }
+        else {
+            fsChanged(filename);
+        }
+        createDirFromPath(filename);
+        ctx.file = m_filesystem->open(ctx.path, "w");
+        if (!ctx.file) {
+            ctx.fail(500, "CREATE FAILED");
             return;
         }
+        ctx.writer.begin(ctx.file);
+        ctx.started = millis();
         log_debug("Upload: START, filename: %s\n", filename.c_str());
     } 
     else if (upload.status == UPLOAD_FILE_WRITE) {
-        if (m_uploadFile) {
-            size_t bytesWritten = m_uploadFile.write(upload.buf, upload.currentSize);
-            if (bytesWritten != upload.currentSize) {
-                this->send(500, "text/plain", "WRITE FAILED");
+        if (ctx.file) {
+            if (ctx.writer.write(upload.buf, upload.currentSize) != upload.currentSize) {
+                // Don't leave a truncated file behind (a replaced file is still there, untouched)
+                m_uploads.closeFile(ctx);
+                m_filesystem->remove(ctx.path);
+                if (ctx.target.isEmpty()) {
+                    fsChanged(ctx.path, FS_CHANGE_DELETED);
+                }
+                ctx.target = "";
+                ctx.fail(500, "WRITE FAILED");
                 return;
             }
+            ctx.received += upload.currentSize;
         }
-        log_debug("Upload: WRITE, Bytes: %d\n", upload.currentSize);
+        log_debug("Upload: WRITE, Bytes: %d (%u of %u)\n", upload.currentSize, ctx.received, ctx.expected);
     } 
     else if (upload.status == UPLOAD_FILE_END) {
-        #if defined(ESP32)
-            const char* filepath = m_uploadFile.path();            
-        #elif defined(ESP8266)
-            const char* filepath = m_uploadFile.fullName();   
-        #endif
+        if (!ctx.file) {
+            return;
+        }
+
+        // Flush and close before anyone (e.g. the config callback) reads the file back
+        bool flushed = m_uploads.closeFile(ctx);
+        ctx.done += ctx.received;
+        if (!ctx.target.isEmpty()) {
+            // LittleFS replaces the target atomically, other filesystems refuse to rename over it
+            bool renamed = flushed && (m_filesystem->rename(ctx.path, ctx.target) ||
+                                       (m_filesystem->remove(ctx.target) && m_filesystem->rename(ctx.path, ctx.target)));
+            if (!renamed) {
+                m_filesystem->remove(ctx.path);
+                ctx.target = "";
+                ctx.fail(500, "WRITE FAILED");
+                return;
+            }
+            ctx.path = ctx.target;
+            ctx.target = "";
+        }
+        fsChanged(ctx.path);
+        if (!flushed) {
+            ctx.fail(500, "WRITE FAILED");
+            return;
+        }
+
+        ctx.started = millis() - ctx.started;   // Elapsed ms
+        log_debug("Upload: %u bytes, %u flash writes, %u KB/s", ctx.writer.bytesWritten(),
+                  ctx.writer.flashWrites(), ctx.started ? ctx.writer.bytesWritten() / ctx.started : 0);
 
         // Call config saved callback if this is the config file
-        if (strcmp(filepath, ESP_FS_WS_CONFIG_FILE) == 0 && m_configSavedCallback) {
+        bool isConfigFile = ctx.path == ESP_FS_WS_CONFIG_FILE;
+        if (isConfigFile && m_configSavedCallback) {
             log_debug("Config file saved, calling callback");
-            m_configSavedCallback(filepath);
+            m_configSavedCallback(ctx.path.c_str());
         }
-
-        if (m_uploadFile) { 
-            m_uploadFile.close();
+        if (isConfigFile) {
+            loadCacheRules();
         }
         log_debug("Upload: END, Size: %d\n", upload.totalSize);
     }
+    else if (upload.status == UPLOAD_FILE_ABORTED) {
+        log_debug("Upload: ABORTED, %s", ctx.path.c_str());
+        if (ctx.target.isEmpty()) {
+            fsChanged(ctx.path, FS_CHANGE_DELETED);
+        }
+        m_uploads.abort(m_filesystem, ctx);
+    }
 }
 
-void FSWebServer::update_first()
+void FSWebServer::handleFileUploadDone()
 {
-    size_t fsize;
-    if (this->hasArg("size"))
-        fsize = this->arg("size").toInt();
+    WiFiClient &client = this->client();
+    UploadContext *ctx = m_uploads.find(client.remoteIP(), client.remotePort());
+    if (ctx && ctx->errorCode) {
+        this->send(ctx->errorCode, "text/plain", ctx->error);
+    }
     else {
-        this->send(500, "text/plain", F("Request malformed: missing file size"));
-        return;
+        sendOK();
     }
+    if (ctx) {
+        m_uploads.release(*ctx);
+    }
+}
 
+void FSWebServer::update_first()
+{
     HTTPUpload& upload = this->upload();
     if (upload.status == UPLOAD_FILE_START) {
+        // Read once: the args don't change while the parts arrive
+        size_t fsize = this->hasArg("size") ? this->arg("size").toInt() : 0;
         log_info("Receiving Update: %s, Size: %d", upload.filename.c_str(), fsize);
-        if (!Update.begin(fsize)) {
-            otaDone = 0;
-            Update.printError(Serial);
-        }
+        beginOta(fsize);
     }
     else if (upload.status == UPLOAD_FILE_WRITE) {
-        if (Update.write(upload.buf, upload.currentSize) != upload.currentSize) {
-            Update.printError(Serial);
-        }
-        else {
-            static uint32_t pTime = millis();
-            if (millis() - pTime > 500) {
-                pTime = millis();
-                otaDone = 100 * Update.progress() / Update.size();
-                log_info("OTA progress: %d%%", otaDone);
-            }
-        }
+        writeOta(upload.buf, upload.currentSize);
     }
     else if (upload.status == UPLOAD_FILE_END) {
-        if (Update.end(true)) {
-            log_info("Update Success: %u bytes\nRebooting...", upload.totalSize);
-        }
-        else {
-#if defined(ESP8266)
-            log_error("%s\n", Update.getErrorString().c_str());
-#elif defined(ESP32)
-            log_error("%s\n", Update.errorString());
-#endif
-            otaDone = 0;
-        }
+        endOta();
+    }
+    else if (upload.status == UPLOAD_FILE_ABORTED) {
+        Update.end();
     }
 }
 
-
-// the request handler is triggered after the upload has finished...
+/*
+    Firmware sent as request body: PUT /update, Content-Length is the size.
+    No multipart parsing, the body goes straight to Update.write()
+*/
+void FSWebServer::update_raw()
+{
+    if (!hasRawBody()) {
+        return;
+    }
+    HTTPRaw &raw = this->raw();
+    if (raw.status == RAW_START) {
+        size_t fsize = this->clientContentLength();
+        log_info("Receiving raw Update, Size: %d", fsize);
+        beginOta(fsize);
+    }
+    else if (raw.status == RAW_WRITE) {
+        writeOta(raw.buf, raw.currentSize);
+    }
+    else if (raw.status == RAW_END) {
+        endOta();
+    }
+    else if (raw.status == RAW_ABORTED) {
+        Update.end();
+    }
+}
+
+bool FSWebServer::beginOta(size_t size)
+{
+    otaDone = 0;
+    m_otaReportAt = millis();
+    if (!size) {
+        log_error("Update size missing");
+        return false;
+    }
+    if (!Update.begin(size)) {
+        Update.printError(Serial);
+        return false;
+    }
+    return true;
+}
+
+void FSWebServer::writeOta(uint8_t *data, size_t length)
+{
+    // After an error the rest of the body is only consumed
+    if (!Update.isRunning() || Update.hasError()) {
+        return;
+    }
+    if (Update.write(data, length) != length) {
+        Update.printError(Serial);
+        return;
+    }
+    if (millis() - m_otaReportAt >= ESP_FS_WS_OTA_REPORT) {
+        m_otaReportAt = millis();
+        otaDone = 100 * Update.progress() / Update.size();
+        log_info("OTA progress: %d%%", otaDone);
+        CJSON::Json doc;
+        doc.setNumber("progress", Update.progress());
+        doc.setNumber("size", Update.size());
+        doc.setNumber("percent", otaDone);
+        sendSetupWsEvent(SETUP_WS_BROADCAST, "ota.progress", doc.serialize());
+    }
+}
+
+void FSWebServer::endOta()
+{
+    if (!Update.isRunning()) {
+        return;
+    }
+    if (Update.end(true)) {
+        otaDone = 100;
+        log_info("Update Success: %u bytes\nRebooting...", Update.size());
+    }
+    else {
+#if defined(ESP8266)
+        log_error("%s\n", Update.getErrorString().c_str());
+#elif defined(ESP32)
+        log_error("%s\n", Update.errorString());
+#endif
+        otaDone = 0;
+    }
+}
+
+
+// the request handler is triggered after the upload has finished...
 // create the response, add header, and send response
 void FSWebServer::update_second()
 {
@@ -942,6 +1571,11 @@ void FSWebServer::update_second()
 #elif defined(ESP32)
         txt += Update.errorString();
 #endif
+    } else if (otaDone != 100) {
+        // Size missing, or no firmware in the request
+        txt = F("Request malformed: missing file size");
+        log_error("%s", txt.c_str());
+        return this->send(400, "text/plain", txt);
     } else {
         txt = F("Update completed successfully. The ESP32 will restart");
     }
@@ -1044,6 +1678,9 @@ void FSWebServer::handleFileEdit() {
         if(!this->authenticate(m_pageUser, m_pagePswd))
             return this->requestAuthentication();
     }
+    if (this->checkNotModified(HttpUtils::makeEtag(EDIT_HTM_HASH), 0, m_cachePolicy.lookup("/edit"))) {
+        return;
+    }
     this->sendHeader(PSTR("Content-Encoding"), "gzip");
     this->send_P(200, "text/html", (const char*)_acedit_htm, sizeof(_acedit_htm));
 }
@@ -1064,37 +1701,511 @@ void FSWebServer::handleFileList()
         return this->send(400, "BAD PATH");
     }
 
-    File root = m_filesystem->open(path, "r");
-    CJSON::Json json_array;
-    json_array.createArray();
-    if (root.isDirectory()) {
-        File file = root.openNextFile();
-        while (file) {
-            String filename;
-            if (typeName.equals("SPIFFS")) {
-                // SPIFFS returns full path and subfolders are unsupported, remove leading '/'                
-                #ifdef ESP32
-                filename += file.path();
-                #elif defined(ESP8266)
-                filename += file.fullName();
-                #endif
-                filename.remove(0, 1);
-            } 
-            else {
-                filename = file.name();
-                if (filename.lastIndexOf("/") > -1) {
-                    filename.remove(0, filename.lastIndexOf("/") + 1);
-                }
-            }                    
-            CJSON::Json item;
-            item.setString("type", (file.isDirectory()) ? "dir" : "file");
-            item.setNumber("size", file.size());
-            item.setString("name", filename);
-            json_array.add(item);
-            file = root.openNextFile();
+    // Optional: offset/limit (pagination), recursive=1, fields=type,size,name,time
+    uint32_t offset = this->arg("offset").toInt();
+    uint32_t limit = this->arg("limit").toInt();
+    bool recursive = this->arg("recursive") == "1" && !typeName.equals("SPIFFS");
+    uint8_t fields = LIST_TYPE | LIST_SIZE | LIST_NAME;
+    if (this->hasArg("fields")) {
+        String list = "," + this->arg("fields") + ",";
+        fields = 0;
+        fields |= list.indexOf(",type,") >= 0 ? LIST_TYPE : 0;
+        fields |= list.indexOf(",size,") >= 0 ? LIST_SIZE : 0;
+        fields |= list.indexOf(",name,") >= 0 ? LIST_NAME : 0;
+        fields |= list.indexOf(",time,") >= 0 ? LIST_TIME : 0;
+    }
+
+    // Entries are written to the socket as they are read: memory doesn't grow with the listing
+    ChunkedResponse<WebServerClass> out(*this);
+    out.begin(200, "text/json");
+    out.write('[');
+
+    DirWalker walker;
+    if (!walker.begin(*m_filesystem, path, recursive)) {
+        out.write(']');
+        out.end();
+        return;
+    }
+
+    File file;
+    String name;
+    uint32_t index = 0, count = 0;
+    while (limit == 0 || count < limit) {
+        DirWalker::Kind kind = walker.next(file, name);
+        if (kind == DirWalker::END) {
+            break;
+        }
+        if (kind == DirWalker::DIR_DONE || index++ < offset) {
+            continue;
+        }
+
+        out.print(count++ ? ",{" : "{");
+        bool first = true;
+        if (fields & LIST_TYPE) {
+            out.print(kind == DirWalker::DIR ? "\"type\":\"dir\"" : "\"type\":\"file\"");
+            first = false;
+        }
+        if (fields & LIST_SIZE) {
+            out.print(first ? "\"size\":" : ",\"size\":");
+            out.print((uint32_t)file.size());
+            first = false;
+        }
+        if (fields & LIST_NAME) {
+            out.print(first ? "\"name\":" : ",\"name\":");
+            out.printJsonString(name.c_str());
+            first = false;
+        }
+        if (fields & LIST_TIME) {
+            out.print(first ? "\"time\":" : ",\"time\":");
+            out.print((uint32_t)file.getLastWrite());
+        }
+        out.write('}');
+        yield();
+    }
+
+    // Limit reached before the end of the walk
+    walker.end();
+    out.write(']');
+    out.end();
+}
+
+/*
+    Download a folder as a single archive: GET /archive?dir=/logs&format=zip|tar
+    The archive is produced while the folder is walked and sent with chunked transfer encoding
+*/
+void FSWebServer::handleArchive()
+{
+    String path = this->hasArg("dir") ? this->arg("dir") : String("/");
+    String format = this->hasArg("format") ? this->arg("format") : String("zip");
+    if (format != "zip" && format != "tar") {
+        return this->send(400, "text/plain", "BAD FORMAT");
+    }
+    DirWalker walker;
+    if (!walker.begin(*m_filesystem, path)) {
+        return this->send(400, "text/plain", "BAD PATH");
+    }
+    uint8_t *buf = (uint8_t *)malloc(ESP_FS_WS_STREAM_CHUNK);
+    if (!buf) {
+        return this->send(500, "text/plain", "OUT OF MEMORY");
+    }
+    log_debug("handleArchive: %s (%s)", path.c_str(), format.c_str());
+
+    // Download name from the folder name ("fs" for the root)
+    String name = path.endsWith("/") ? path.substring(0, path.length() - 1) : path;
+    name = name.substring(name.lastIndexOf('/') + 1);
+    String disposition = "attachment; filename=\"";
+    disposition += name.length() ? name : String("fs");
+    disposition += "." + format + "\"";
+    this->sendHeader("Content-Disposition", disposition);
+
+    ChunkedResponse<WebServerClass> out(*this);
+    out.begin(200, format == "zip" ? "application/zip" : "application/x-tar");
+    ArchiveWriter archive(out, format == "zip" ? ArchiveWriter::ZIP : ArchiveWriter::TAR);
+    String base = path.endsWith("/") ? path : path + "/";
+    std::vector<String> pending;    // Folders too deep for the walker, archived next
+    String prefix;                  // Relative path of the folder being walked
+    File file;
+    String entry;
+    while (true) {
+        uint8_t depth = walker.depth();
+        DirWalker::Kind kind = walker.next(file, entry);
+        if (kind == DirWalker::DIR) {
+            entry = prefix + entry;
+            archive.addDirectory(entry, file.getLastWrite());
+            if (walker.depth() == depth) {
+                // Not entered
+                pending.push_back(entry);
+            }
+        }
+        else if (kind == DirWalker::FILE_ENTRY) {
+            archive.addFile(prefix + entry, file, file.getLastWrite(), buf, ESP_FS_WS_STREAM_CHUNK);
+        }
+        else if (kind == DirWalker::END) {
+            if (pending.empty()) {
+                break;
+            }
+            prefix = pending.back() + "/";
+            pending.pop_back();
+            if (!walker.begin(*m_filesystem, base + prefix.substring(0, prefix.length() - 1))) {
+                log_error("Archive: can't open %s%s", base.c_str(), prefix.c_str());
+            }
+        }
+        if (!this->client().connected()) {
+            log_debug("Archive download interrupted");
+            break;
+        }
+        yield();
+    }
+    walker.end();
+    archive.finish();
+    out.end();
+    free(buf);
+    log_debug("Archive: %u entries, %u bytes", archive.entries(), archive.bytesWritten());
+}
+
+/*
+    Find files by name and/or content, e.g. GET /search?dir=/logs&name=*.csv&contains=0A1B2C&limit=20
+    One JSON object per line (NDJSON), sent while the tree is walked:
+    {"path":"/logs/2024/01.csv","offset":5120,"line":"...;0A1B2C;..."}   (content match)
+    {"path":"/logs/2024/01.csv","size":48213}                          (name only search)
+    {"files":42,"matches":20,"truncated":true,"next":"17:5126"}        (last line)
+    A request works for ESP_FS_WS_SEARCH_BUDGET ms at most. "next" is there when the search stopped
+    before the end of the tree (time or limit): the same request with &after=<next> goes on from there
+*/
+void FSWebServer::handleSearch()
+{
+    String path = this->hasArg("dir") ? this->arg("dir") : String("/");
+    String name = this->arg("name");
+    String contains = this->arg("contains");
+    if (name.isEmpty() && contains.isEmpty()) {
+        return this->send(400, "text/plain", "NAME OR CONTAINS MISSING");
+    }
+    long limit = this->hasArg("limit") ? this->arg("limit").toInt() : ESP_FS_WS_SEARCH_LIMIT;
+    if (limit <= 0) {
+        limit = ESP_FS_WS_SEARCH_LIMIT;
+    }
+    // Cursor "<files walked>:<offset in the next one>"
+    size_t skip = 0;
+    uint32_t skipOffset = 0;
+    String after = this->arg("after");
+    if (!after.isEmpty()) {
+        int colon = after.indexOf(':');
+        skip = after.toInt();
+        skipOffset = colon > 0 ? after.substring(colon + 1).toInt() : 0;
+    }
+    FileSearch search;
+    if (!contains.isEmpty() && !search.begin(contains)) {
+        return this->send(400, "text/plain", "BAD CONTAINS");
+    }
+    DirWalker walker;
+    if (!walker.begin(*m_filesystem, path)) {
+        return this->send(400, "text/plain", "BAD PATH");
+    }
+    log_debug("handleSearch: %s name '%s' contains '%s' after %u:%u", path.c_str(), name.c_str(), contains.c_str(),
+              (unsigned)skip, (unsigned)skipOffset);
+    search.setBudget(ESP_FS_WS_SEARCH_BUDGET);
+
+    ChunkedResponse<WebServerClass> out(*this);
+    out.begin(200, "application/x-ndjson");
+    std::vector<String> pending;    // Folders too deep for the walker, searched next
+    File file;
+    String entry;
+    size_t walked = 0;              // Files of the tree met so far, in walk order
+    size_t files = 0;
+    long matches = 0;
+    String next;
+    while (true) {
+        uint8_t depth = walker.depth();
+        DirWalker::Kind kind = walker.next(file, entry);
+        if (kind == DirWalker::DIR) {
+            if (walker.depth() == depth) {
+                // Not entered
+                pending.push_back(walker.fullPath(entry));
+            }
+            continue;
+        }
+        if (kind == DirWalker::END) {
+            if (pending.empty()) {
+                break;
+            }
+            String dir = pending.back();
+            pending.pop_back();
+            if (!walker.begin(*m_filesystem, dir)) {
+                log_error("Search: can't open %s", dir.c_str());
+            }
+            continue;
+        }
+        if (kind != DirWalker::FILE_ENTRY || walked++ < skip) {
+            continue;
+        }
+        uint32_t from = walked - 1 == skip ? skipOffset : 0;
+        if (matches >= limit || search.expired()) {
+            next = String(walked - 1) + ":" + from;
+            break;
+        }
+        const char *base = strrchr(entry.c_str(), '/');
+        if (!name.isEmpty() && !HttpUtils::globMatch(name.c_str(), base ? base + 1 : entry.c_str())) {
+            continue;
+        }
+        files++;
+        String fullPath = walker.fullPath(entry);
+        if (contains.isEmpty()) {
+            out.print("{\"path\":");
+            out.printJsonString(fullPath.c_str());
+            out.print(",\"size\":");
+            out.print((uint32_t)file.size());
+            out.print("}\n");
+            matches++;
+        }
+        else if (from == 0 || file.seek(from, SeekSet)) {
+            bool done = search.scan(file, [&](uint32_t offset, const char *line) {
+                out.print("{\"path\":");
+                out.printJsonString(fullPath.c_str());
+                out.print(",\"offset\":");
+                out.print(offset);
+                out.print(",\"line\":");
+                out.printJsonString(line);
+                out.print("}\n");
+                return ++matches < limit;
+            });
+            if (!done) {
+                // Stopped inside this file: go on from there next time
+                next = String(walked - 1) + ":" + search.resumeOffset();
+                break;
+            }
+        }
+        if (!this->client().connected()) {
+            log_debug("Search interrupted");
+            break;
+        }
+        search.yieldIfDue();
+    }
+    walker.end();
+    out.printf("{\"files\":%u,\"matches\":%ld,\"truncated\":%s", (unsigned)files, matches,
+               matches >= limit ? "true" : "false");
+    if (!next.isEmpty()) {
+        out.print(",\"next\":");
+        out.printJsonString(next.c_str());
+    }
+    out.print("}\n");
+    out.end();
+}
+
+/*
+    Disk usage of a folder: GET /du?dir=/&depth=1
+    {"dir":"/","depth":1,"bytes":81234,"files":57,"age":12,
+     "dirs":[{"path":"/logs","bytes":61234,"files":40},...],"top":[{"path":"/logs/big.csv","size":20480},...]}
+    Each folder down to depth levels includes its subfolders; "age" is in seconds.
+    The first request starts a background walk (continued by run()) and gets 202 with
+    {"state":"running","files":N} until it is done. The result is then kept, and returned at once,
+    until something changes inside dir
+*/
+void FSWebServer::handleDiskUsage()
+{
+    String path = this->hasArg("dir") ? this->arg("dir") : String("/");
+    long depth = this->hasArg("depth") ? this->arg("depth").toInt() : 1;
+    depth = depth < 0 ? 0 : depth > 16 ? 16 : depth;
+    if (!m_diskUsage.matches(path, depth) && !m_diskUsage.begin(*m_filesystem, path, depth)) {
+        return this->send(400, "text/plain", "BAD PATH");
+    }
+    if (m_diskUsage.run(ESP_FS_WS_DU_BUDGET)) {
+        CJSON::Json doc;
+        doc.setString("state", "running");
+        doc.setNumber("files", m_diskUsage.files());
+        return this->send(202, "application/json", doc.serialize());
+    }
+
+    const String &dir = m_diskUsage.dir();
+    String base = dir == "/" ? dir : dir + "/";
+    ChunkedResponse<WebServerClass> out(*this);
+    out.begin(200, "application/json");
+    out.print("{\"dir\":");
+    out.printJsonString(dir.c_str());
+    out.printf(",\"depth\":%u,\"bytes\":", (unsigned)m_diskUsage.depth());
+    out.print((unsigned long long)m_diskUsage.bytes());
+    out.printf(",\"files\":%u,\"age\":%u,\"stale\":%s,\"dirs\":[", (unsigned)m_diskUsage.files(),
+               (unsigned)(m_diskUsage.age() / 1000), m_diskUsage.dirty() ? "true" : "false");
+    bool first = true;
+    for (const DiskUsage::Folder &folder : m_diskUsage.folders()) {
+        out.print(first ? "{\"path\":" : ",{\"path\":");
+        out.printJsonString((base + folder.path).c_str());
+        out.print(",\"bytes\":");
+        out.print((unsigned long long)folder.bytes);
+        out.printf(",\"files\":%u}", (unsigned)folder.files);
+        first = false;
+    }
+    out.print("],\"top\":[");
+    for (uint8_t i = 0; i < m_diskUsage.topCount(); i++) {
+        out.print(i ? ",{\"path\":" : "{\"path\":");
+        out.printJsonString((base + m_diskUsage.top()[i].path).c_str());
+        out.printf(",\"size\":%u}", (unsigned)m_diskUsage.top()[i].size);
+    }
+    out.print("]}");
+    out.end();
+    if (m_diskUsage.dirty()) {
+        // Changed while walking: the next request walks again
+        m_diskUsage.invalidate(String());
+    }
+}
+
+/*
+    Filesystem changes after a sequence number: GET /changes?since=12
+    {"seq":14,"reset":false,"changes":[{"seq":13,"type":"created","path":"/www/new.js"},...]}
+*/
+void FSWebServer::handleChanges()
+{
+    uint32_t since = this->hasArg("since") ? (uint32_t)this->arg("since").toInt() : 0;
+    this->send(200, "application/json", buildFsChangesPayload(since));
+}
+
+/*
+    Unpack a tar (or tar.gz) archive sent as request body: POST /extract?dir=/www
+    Entries are written while the body is received
+*/
+void FSWebServer::handleExtract()
+{
+    if (!hasRawBody()) {
+        return;
+    }
+    HTTPRaw &raw = this->raw();
+    if (raw.status == RAW_START) {
+        String dir = this->hasArg("dir") ? this->arg("dir") : String("/");
+        if (!dir.startsWith("/")) {
+            dir = "/" + dir;
+        }
+        log_debug("handleExtract: %s", dir.c_str());
+        fsChanged(dir);
+        delete m_extractor;
+        m_extractor = new TarExtractor(*m_filesystem, dir, m_extractCallback);
+    }
+    else if (raw.status == RAW_WRITE && m_extractor) {
+        m_extractor->write(raw.buf, raw.currentSize);
+    }
+    else if (raw.status == RAW_ABORTED && m_extractor) {
+        // Removes the file being written
+        m_extractor->end();
+    }
+}
+
+void FSWebServer::handleExtractDone(bool sync)
+{
+    if (!m_extractor) {
+        return this->send(400, "text/plain", "NO DATA");
+    }
+    bool ok = m_extractor->end();
+
+    CJSON::Json doc;
+    doc.setNumber("files", m_extractor->files());
+    doc.setNumber("dirs", m_extractor->dirs());
+    doc.setNumber("bytes", m_extractor->bytes());
+    if (sync) {
+        // Deletions are applied only if all the new content was written
+        doc.setNumber("deleted", ok ? applySyncDeletes(m_extractor->dir()) : 0);
+    }
+    fsChanged(m_extractor->dir());
+
+    int code = 200;
+    if (!ok) {
+        const char *error = m_extractor->error();
+        doc.setString("error", error);
+        if (strcmp(error, "GZIP NOT SUPPORTED") == 0) {
+            code = 415;
+        }
+        else if (strcmp(error, "BAD ARCHIVE") == 0 || strcmp(error, "BAD GZIP") == 0 || strcmp(error, "TRUNCATED") == 0) {
+            code = 400;
+        }
+        else {
+            code = 500;
         }
     }
-    this->send(200, "text/json", json_array.serialize());
+    delete m_extractor;
+    m_extractor = nullptr;
+    this->send(code, "application/json", doc.serialize());
+}
+
+/*
+    Differential sync
+    GET  /sync/manifest?dir=/data   [{"path":"css/app.css","size":1234,"crc":"1a2b3c4d"},...]
+    POST /sync/apply?dir=/data      tar (or tar.gz) body with the new and changed files, plus an optional
+                                    ESP_FS_WS_SYNC_DELETE_LIST entry listing the paths to remove, one per line
+*/
+void FSWebServer::handleSyncManifest()
+{
+    String path = this->hasArg("dir") ? this->arg("dir") : String("/");
+    DirWalker walker;
+    if (!walker.begin(*m_filesystem, path)) {
+        return this->send(400, "text/plain", "BAD PATH");
+    }
+    uint8_t *buf = (uint8_t *)malloc(ESP_FS_WS_STREAM_CHUNK);
+    if (!buf) {
+        return this->send(500, "text/plain", "OUT OF MEMORY");
+    }
+
+    ChunkedResponse<WebServerClass> out(*this);
+    out.begin(200, "application/json");
+    out.write('[');
+    String base = path.endsWith("/") ? path : path + "/";
+    std::vector<String> pending;    // Folders too deep for the walker, listed next
+    String prefix;                  // Relative path of the folder being walked
+    File file;
+    String entry;
+    size_t count = 0;
+    while (true) {
+        uint8_t depth = walker.depth();
+        DirWalker::Kind kind = walker.next(file, entry);
+        if (kind == DirWalker::DIR) {
+            if (walker.depth() == depth) {
+                // Not entered
+                pending.push_back(prefix + entry);
+            }
+            continue;
+        }
+        if (kind == DirWalker::END) {
+            if (pending.empty()) {
+                break;
+            }
+            prefix = pending.back() + "/";
+            pending.pop_back();
+            if (!walker.begin(*m_filesystem, base + prefix.substring(0, prefix.length() - 1))) {
+                log_error("Manifest: can't open %s%s", base.c_str(), prefix.c_str());
+            }
+            continue;
+        }
+        if (kind != DirWalker::FILE_ENTRY) {
+            continue;
+        }
+        String name = prefix + entry;
+        // Not part of the synced content: a pending delete list, partial and resumable uploads
+        if (name == ESP_FS_WS_SYNC_DELETE_LIST || name.endsWith(ESP_FS_WS_UPLOAD_PART_EXT) ||
+            name.endsWith(ESP_FS_WS_UPLOAD_PART_EXT ".ack")) {
+            continue;
+        }
+        uint32_t crc = m_hashCache.get(base + name, file, buf, ESP_FS_WS_STREAM_CHUNK);
+        char hex[9];
+        snprintf(hex, sizeof(hex), "%08x", (unsigned)crc);
+        out.print(count++ ? ",{\"path\":" : "{\"path\":");
+        out.printJsonString(name.c_str());
+        out.print(",\"size\":");
+        out.print((uint32_t)file.size());
+        out.print(",\"crc\":\"");
+        out.print(hex);
+        out.print("\"}");
+        yield();
+    }
+    walker.end();
+    out.write(']');
+    out.end();
+    free(buf);
+}
+
+size_t FSWebServer::applySyncDeletes(const String &dir)
+{
+    String listPath = dir + "/" ESP_FS_WS_SYNC_DELETE_LIST;
+    File list = m_filesystem->open(listPath, "r");
+    if (!list) {
+        return 0;
+    }
+    size_t count = 0;
+    while (list.available()) {
+        String name = list.readStringUntil('\n');
+        name.trim();
+        while (name.startsWith("/")) {
+            name.remove(0, 1);
+        }
+        // Same rule as the archive entries: nothing outside dir
+        if (name.isEmpty() || ("/" + name + "/").indexOf("/../") >= 0) {
+            continue;
+        }
+        String target = dir + "/" + name;
+        if (m_filesystem->exists(target)) {
+            deleteContent(target);
+            count++;
+        }
+        yield();
+    }
+    list.close();
+    m_filesystem->remove(listPath);
+    return count;
 }
 
 /*
@@ -1140,6 +2251,7 @@ void FSWebServer::handleFileCreate()
                 return this->send(500, "CREATE FAILED");
             }
         }
+        fsChanged(path, FS_CHANGE_CREATED);
         this->send(200,  path.c_str());
     }
     else  {
@@ -1161,6 +2273,8 @@ void FSWebServer::handleFileCreate()
         if (!m_filesystem->rename(src, path))  {
             return this->send(500, "RENAME FAILED");
         }
+        fsChanged(src, FS_CHANGE_DELETED);
+        fsChanged(path, FS_CHANGE_CREATED);
         this->sendOK();
     }
 }
@@ -1171,54 +2285,340 @@ void FSWebServer::handleFileCreate()
     ---------------+--------------------------------------------------------------
     Delete file    | parent of deleted file, or remaining ancestor
     Delete folder  | parent of deleted folder, or remaining ancestor
+
+    Folders are deleted in the background: the reply is sent at once, with the job id in the
+    X-Job-Id header, and the progress is broadcast as "fs.delete" events on the setup WebSocket
 */
 
 void FSWebServer::deleteContent(String& path) {
-  File file = m_filesystem->open(path.c_str(), "r");
-  if (!file.isDirectory()) {
-    file.close();
-    m_filesystem->remove(path.c_str());
-    log_info("File %s deleted", path.c_str());
-    return;
-  }
-
-  file.rewindDirectory();
-  while (true) {
-    File entry = file.openNextFile();
-    if (!entry) {
-      break;
-    }
-    String entryPath = path;
-    entryPath += "/";
-    entryPath += entry.name();
-    if (entry.isDirectory()) {
-      entry.close();
-      deleteContent(entryPath);
-    }
-    else {
-      entry.close();
-      m_filesystem->remove(entryPath.c_str());
-      log_info("File %s deleted", path.c_str());
+    // Same iterative delete of the background jobs, run to completion
+    DeleteJob job;
+    if (job.begin(*m_filesystem, path)) {
+        while (job.run(ESP_FS_WS_DELETE_BUDGET)) {
+            yield();
+        }
     }
-    yield();
-  }
-  m_filesystem->rmdir(path.c_str());
-  log_info("Folder %s removed", path.c_str());
-  file.close();
 }
 
-
-
 void FSWebServer::handleFileDelete() {
     String path = this->arg((size_t)0);
+    while (path.length() > 1 && path.endsWith("/")) {
+        path.remove(path.length() - 1);
+    }
     if (path.isEmpty() || path == "/")  {
         return this->send(400, "BAD PATH");
     }
     if (!m_filesystem->exists(path))  {
         return this->send(400, "File Not Found");
     }
-    deleteContent(path);
-    this->sendOK();
+    File file = m_filesystem->open(path, "r");
+    bool isDir = file.isDirectory();
+    file.close();
+    if (!isDir) {
+        deleteContent(path);
+        fsChanged(path, FS_CHANGE_DELETED);
+        return this->sendOK();
+    }
+
+    // Folders are deleted by run(), one time slice at a time, so a large tree doesn't block the server
+    DeleteJob *job = nullptr;
+    for (DeleteJob &slot : m_deleteJobs) {
+        if (slot.active() && slot.path() == path) {
+            job = &slot;
+            break;
+        }
+        if (slot.state() == DeleteJob::IDLE && !job) {
+            job = &slot;
+        }
+    }
+    if (!job) {
+        return this->send(503, "text/plain", "BUSY");
+    }
+    if (!job->active()) {
+        // Nothing served from the tree from now on. The change is recorded once the job ends
+        dropFsCaches(path);
+        job->begin(*m_filesystem, path, ++m_deleteJobId);
+        job->run(ESP_FS_WS_DELETE_BUDGET);
+    }
+    log_debug("Delete job %u: %s", (unsigned)job->id(), path.c_str());
+    this->sendHeader("X-Job-Id", String(job->id()));
+
+    if (job->active()) {
+        // Still running: the editor waits for the "done" fs.delete event, then refreshes the folder
+        return this->send(202, "text/plain", path);
+    }
+    // Small folder, gone within the first slice
+    DeleteJob::State state = job->state();
+    fsChanged(path, state == DeleteJob::DONE ? FS_CHANGE_DELETED : FS_CHANGE_MODIFIED);
+    job->clear();
+    if (state != DeleteJob::DONE) {
+        return this->send(500, "text/plain", "DELETE FAILED");
+    }
+    // The editor refreshes the folder given as response text
+    String parent = path.substring(0, path.lastIndexOf('/'));
+    this->send(200, "text/plain", parent.isEmpty() ? String("/") : parent);
+}
+
+void FSWebServer::runDeleteJobs() {
+    for (DeleteJob &job : m_deleteJobs) {
+        if (job.state() == DeleteJob::IDLE) {
+            continue;
+        }
+        bool running = job.run(ESP_FS_WS_DELETE_BUDGET);
+        if (running && millis() - m_deleteReportAt < ESP_FS_WS_DELETE_REPORT) {
+            return;
+        }
+        m_deleteReportAt = millis();
+#if ESP_FS_WS_SETUP
+        CJSON::Json doc;
+        doc.setNumber("id", job.id());
+        doc.setString("path", job.path());
+        doc.setNumber("files", job.files());
+        doc.setNumber("dirs", job.dirs());
+        doc.setString("state", running ? "running" : job.state() == DeleteJob::DONE ? "done" : "failed");
+        sendSetupWsEvent(SETUP_WS_BROADCAST, "fs.delete", doc.serialize());
+#endif
+        if (!running) {
+            fsChanged(job.path(), job.state() == DeleteJob::DONE ? FS_CHANGE_DELETED : FS_CHANGE_MODIFIED);
+            job.clear();
+        }
+        // One time slice per run()
+        return;
+    }
+}
+
+/*
+    Batch of file operations, executed in order with a single request
+    POST /batch[?stop=1]  body: [{"op":"mkdir","path":"/www/img"},
+                                 {"op":"move","from":"/logo.png","to":"/www/img/logo.png"},
+                                 {"op":"copy","from":"/www","to":"/www.bak"},
+                                 {"op":"delete","path":"/old"}]
+    The results are streamed while the operations run, one per operation:
+    [{"i":0,"ok":true},{"i":1,"ok":false,"error":"NOT FOUND"},...]
+    With stop=1 the operations after the first failure are not executed (nor reported)
+*/
+void FSWebServer::handleBatch()
+{
+    cJSON *ops = cJSON_Parse(this->arg("plain").c_str());
+    if (!cJSON_IsArray(ops)) {
+        cJSON_Delete(ops);
+        return this->send(400, "text/plain", "BAD JSON");
+    }
+    bool stopOnError = this->hasArg("stop") && this->arg("stop") != "0";
+
+    ChunkedResponse<WebServerClass> out(*this);
+    out.begin(200, "application/json");
+    out.write('[');
+    size_t index = 0;
+    const cJSON *op;
+    cJSON_ArrayForEach(op, ops) {
+        const char *error = runBatchOp(op);
+        out.print(index ? ",{\"i\":" : "{\"i\":");
+        out.print((uint32_t)index);
+        if (error) {
+            out.print(",\"ok\":false,\"error\":");
+            out.printJsonString(error);
+            out.write('}');
+        }
+        else {
+            out.print(",\"ok\":true}");
+        }
+        index++;
+        yield();
+        if (error && stopOnError) {
+            break;
+        }
+    }
+    out.write(']');
+    out.end();
+    cJSON_Delete(ops);
+}
+
+// Absolute path without trailing "/", empty if missing, "/" or outside the filesystem tree
+static String batchPath(const cJSON *op, const char *key)
+{
+    const cJSON *item = cJSON_GetObjectItemCaseSensitive(op, key);
+    if (!cJSON_IsString(item)) {
+        return String();
+    }
+    String path = item->valuestring;
+    while (path.endsWith("/")) {
+        path.remove(path.length() - 1);
+    }
+    if (!path.startsWith("/") || (path + "/").indexOf("/../") >= 0) {
+        return String();
+    }
+    return path;
+}
+
+const char *FSWebServer::runBatchOp(const cJSON *op)
+{
+    const cJSON *name = cJSON_GetObjectItemCaseSensitive(op, "op");
+    if (!cJSON_IsString(name)) {
+        return "BAD OP";
+    }
+    String type = name->valuestring;
+
+    if (type == "delete" || type == "mkdir") {
+        String path = batchPath(op, "path");
+        if (path.isEmpty()) {
+            return "BAD PATH";
+        }
+        if (type == "mkdir") {
+            String created;
+            bool ok = makeDirs(path, created);
+            if (!created.isEmpty()) {
+                fsChanged(created, FS_CHANGE_CREATED);
+            }
+            return ok ? nullptr : "MKDIR FAILED";
+        }
+        if (!m_filesystem->exists(path)) {
+            return "NOT FOUND";
+        }
+        deleteContent(path);
+        bool left = m_filesystem->exists(path);
+        fsChanged(path, left ? FS_CHANGE_MODIFIED : FS_CHANGE_DELETED);
+        return left ? "DELETE FAILED" : nullptr;
+    }
+
+    if (type == "move" || type == "copy") {
+        String from = batchPath(op, "from");
+        String to = batchPath(op, "to");
+        if (from.isEmpty() || to.isEmpty()) {
+            return "BAD PATH";
+        }
+        if (to == from || to.startsWith(from + "/")) {
+            return "BAD TARGET";
+        }
+        if (!m_filesystem->exists(from)) {
+            return "NOT FOUND";
+        }
+        if (m_filesystem->exists(to)) {
+            return "TARGET EXISTS";
+        }
+        String created;
+        bool parentOk = makeDirs(to.substring(0, to.lastIndexOf('/')), created);
+        if (!created.isEmpty()) {
+            fsChanged(created, FS_CHANGE_CREATED);
+        }
+        if (!parentOk) {
+            return "MKDIR FAILED";
+        }
+        if (type == "move") {
+            if (!m_filesystem->rename(from, to)) {
+                return "RENAME FAILED";
+            }
+            fsChanged(from, FS_CHANGE_DELETED);
+            fsChanged(to, FS_CHANGE_CREATED);
+            return nullptr;
+        }
+        bool ok = copyContent(from, to);
+        if (m_filesystem->exists(to)) {
+            // A folder copied only in part stays
+            fsChanged(to, FS_CHANGE_CREATED);
+        }
+        return ok ? nullptr : "COPY FAILED";
+    }
+    return "BAD OP";
+}
+
+bool FSWebServer::makeDirs(const String &dir, String &created)
+{
+    created = "";
+    // Create the missing levels, from the top
+    int pos = 0;
+    while (pos >= 0 && dir.length() > 1) {
+        pos = dir.indexOf('/', pos + 1);
+        String level = pos < 0 ? dir : dir.substring(0, pos);
+        File file = m_filesystem->open(level, "r");
+        if (file) {
+            bool isDir = file.isDirectory();
+            file.close();
+            if (!isDir) {
+                log_error("Can't create %s: %s is a file", dir.c_str(), level.c_str());
+                return false;
+            }
+            continue;
+        }
+        if (!m_filesystem->mkdir(level)) {
+            return false;
+        }
+        if (created.isEmpty()) {
+            created = level;
+        }
+    }
+    return true;
+}
+
+/*
+    Copy a file, or a folder with its content (all subfolders included)
+*/
+bool FSWebServer::copyContent(const String &from, const String &to)
+{
+    uint8_t *buf = (uint8_t *)malloc(ESP_FS_WS_FS_BLOCK_SIZE);
+    if (!buf) {
+        return false;
+    }
+    auto copyFile = [&](File &src, const String &path) {
+        File dst = m_filesystem->open(path, "w");
+        if (!dst) {
+            return false;
+        }
+        bool ok = true;
+        size_t n;
+        // Whole blocks: every write fills the next filesystem block of the copy
+        while (ok && (n = src.read(buf, ESP_FS_WS_FS_BLOCK_SIZE)) > 0) {
+            ok = dst.write(buf, n) == n;
+            yield();
+        }
+        dst.close();
+        if (!ok) {
+            m_filesystem->remove(path);
+        }
+        return ok;
+    };
+
+    bool ok = true;
+    File src = m_filesystem->open(from, "r");
+    if (!src.isDirectory()) {
+        ok = copyFile(src, to);
+        src.close();
+    }
+    else {
+        src.close();
+        DirWalker walker;
+        ok = walker.begin(*m_filesystem, from) && m_filesystem->mkdir(to);
+        std::vector<String> pending;    // Folders too deep for the walker, copied next
+        String prefix;                  // Relative path of the folder being walked
+        File file;
+        String name;
+        while (ok) {
+            uint8_t depth = walker.depth();
+            DirWalker::Kind kind = walker.next(file, name);
+            if (kind == DirWalker::DIR) {
+                name = prefix + name;
+                ok = m_filesystem->mkdir(to + "/" + name);
+                if (walker.depth() == depth) {
+                    // Not entered
+                    pending.push_back(name);
+                }
+            }
+            else if (kind == DirWalker::FILE_ENTRY) {
+                ok = copyFile(file, to + "/" + prefix + name);
+            }
+            else if (kind == DirWalker::END) {
+                if (pending.empty()) {
+                    break;
+                }
+                prefix = pending.back() + "/";
+                pending.pop_back();
+                ok = walker.begin(*m_filesystem, from + "/" + prefix.substring(0, prefix.length() - 1));
+            }
+        }
+    }
+    free(buf);
+    log_debug("Copy %s to %s: %s", from.c_str(), to.c_str(), ok ? "OK" : "FAILED");
+    return ok;
 }
 
 /*
@@ -1252,5 +2652,241 @@ void FSWebServer::handleFsStatus()
     doc.setString("unsupportedFiles", "");
     this->send(200, "application/json", doc.serialize());
 }
+
+#if ESP_FS_WS_UPLOAD_SESSIONS
+/*
+    Resumable uploads
+    POST   /upload?path=/fw.bin&size=N[&crc=hex]   start or resume, returns the session
+    PUT    /upload?id=hex&offset=N&crc=hex         raw chunk body (application/octet-stream)
+    GET    /upload?id=hex                          session status
+    POST   /upload/commit?id=hex                   verify and rename to path
+    DELETE /upload?id=hex                          abort, the partial file is deleted
+*/
+void FSWebServer::sendUploadResult(UploadSessionTable::Result result, const UploadSession *session)
+{
+    static const int codes[] = {200, 404, 503, 409, 422, 409, 422, 500, 400};
+    static const char *const errors[] = {"", "UNKNOWN SESSION", "TOO MANY UPLOADS", "BAD OFFSET",
+                                         "BAD CHUNK CRC", "INCOMPLETE", "BAD FILE CRC", "WRITE FAILED", "NO DATA"};
+    CJSON::Json doc;
+    if (session) {
+        char id[9];
+        snprintf(id, sizeof(id), "%08x", (unsigned)session->id);
+        doc.setString("id", id);
+        doc.setString("path", session->path);
+        doc.setNumber("size", session->size);
+        doc.setNumber("offset", session->offset);
+    }
+    if (result != UploadSessionTable::OK) {
+        doc.setString("error", errors[result]);
+    }
+    this->send(codes[result], "application/json", doc.serialize());
+}
+
+void FSWebServer::handleUploadStart()
+{
+    String path = this->arg("path");
+    if (!path.startsWith("/")) {
+        path = "/" + path;
+    }
+    if (path.length() < 2 || path.endsWith("/") || !this->hasArg("size")) {
+        return this->send(400, "text/plain", "BAD ARGS");
+    }
+    size_t size = strtoul(this->arg("size").c_str(), nullptr, 10);
+
+    // The temporary file grows next to the target until the commit (a resumed one is reused)
+    File part = m_filesystem->open(path + ESP_FS_WS_UPLOAD_PART_EXT, "r");
+    uint64_t freeBytes = fsFreeBytes() + (part ? part.size() : 0);
+    part.close();
+    if (size + ESP_FS_WS_UPLOAD_MIN_FREE > freeBytes) {
+        log_error("Upload of %s refused: %u bytes, %u free", path.c_str(), (unsigned)size, (unsigned)freeBytes);
+        return this->send(507, "text/plain", "INSUFFICIENT STORAGE");
+    }
+    createDirFromPath(path);
+
+    bool hasHash = this->hasArg("crc");
+    uint32_t hash = strtoul(this->arg("crc").c_str(), nullptr, 16);
+    UploadSessionTable::Result result;
+    UploadSession *session = m_uploadSessions.start(path, size, hash, hasHash, result);
+    sendUploadResult(result, session);
+}
+
+void FSWebServer::handleUploadChunk()
+{
+    if (!hasRawBody()) {
+        return;
+    }
+    HTTPRaw &raw = this->raw();
+    if (raw.status == RAW_START) {
+        m_uploadSessions.beginChunk(strtoul(this->arg("id").c_str(), nullptr, 16),
+                                    strtoul(this->arg("offset").c_str(), nullptr, 10),
+                                    strtoul(this->arg("crc").c_str(), nullptr, 16));
+    }
+    else if (raw.status == RAW_WRITE) {
+        m_uploadSessions.writeChunk(raw.buf, raw.currentSize);
+    }
+    else if (raw.status == RAW_ABORTED) {
+        // Partial chunk: not acknowledged, the client sends it again
+        m_uploadSessions.endChunk();
+    }
+}
+
+void FSWebServer::handleUploadChunkDone()
+{
+    UploadSessionTable::Result result = m_uploadSessions.endChunk();
+    sendUploadResult(result, m_uploadSessions.find(strtoul(this->arg("id").c_str(), nullptr, 16)));
+}
+
+void FSWebServer::handleUploadStatus()
+{
+    UploadSession *session = m_uploadSessions.find(strtoul(this->arg("id").c_str(), nullptr, 16));
+    sendUploadResult(session ? UploadSessionTable::OK : UploadSessionTable::NOT_FOUND, session);
+}
+
+void FSWebServer::handleUploadCommit()
+{
+    uint32_t id = strtoul(this->arg("id").c_str(), nullptr, 16);
+    UploadSession *session = m_uploadSessions.find(id);
+    String path = session ? session->path : String();
+    UploadSessionTable::Result result = m_uploadSessions.commit(id);
+    if (result == UploadSessionTable::OK) {
+        fsChanged(path);
+        CJSON::Json doc;
+        doc.setString("path", path);
+        return this->send(200, "application/json", doc.serialize());
+    }
+    // Still open only if more data is needed
+    sendUploadResult(result, m_uploadSessions.find(id));
+}
+
+void FSWebServer::handleUploadAbort()
+{
+    m_uploadSessions.abort(strtoul(this->arg("id").c_str(), nullptr, 16));
+    sendOK();
+}
+#endif
 #endif // ESP_FS_WS_EDIT
 
+#if defined(ESP32) && ESP_FS_WS_SERVER_TASK
+bool FSWebServer::startServerTask(BaseType_t core, uint32_t stackSize, UBaseType_t priority) {
+    if (m_serverTask) {
+        return true;
+    }
+    m_serverTaskStop = false;
+    if (xTaskCreatePinnedToCore(serverTask, "fsWebServer", stackSize, this, priority, &m_serverTask, core) != pdPASS) {
+        log_error("Server task not started");
+        m_serverTask = nullptr;
+        return false;
+    }
+    log_info("Server task started on core %d", (int)core);
+    return true;
+}
+
+void FSWebServer::stopServerTask() {
+    if (!m_serverTask || !fromOtherTask()) {
+        return;
+    }
+    m_serverTaskStop = true;
+    while (m_serverTask) {
+        delay(1);
+    }
+}
+
+void FSWebServer::serverTask(void *arg) {
+    FSWebServer *self = static_cast<FSWebServer *>(arg);
+    while (!self->m_serverTaskStop) {
+        self->processOutbox();
+        self->run();
+        // Let lower priority tasks (and the idle task watchdog) run
+        vTaskDelay(1);
+    }
+    self->processOutbox();
+    self->m_serverTask = nullptr;
+    vTaskDelete(nullptr);
+}
+
+bool FSWebServer::postToServer(OutboxKind kind, uint8_t client, const uint8_t *data, size_t length) {
+    OutboxMessage msg = {kind, client, nullptr, length};
+    if (length) {
+        // One extra byte: text frames are sent as C strings
+        msg.data = (uint8_t *)malloc(length + 1);
+        if (!msg.data) {
+            return false;
+        }
+        memcpy(msg.data, data, length);
+        msg.data[length] = '\0';
+    }
+    if (!m_outbox.push(msg)) {
+        free(msg.data);
+        return false;
+    }
+    return true;
+}
+
+void FSWebServer::processOutbox() {
+    OutboxMessage msg;
+    while (m_outbox.pop(msg)) {
+        if (msg.kind == OUTBOX_FS_CHANGE) {
+            // queueFsChanged() from an application task ("" drops the caches only)
+            fsChanged(msg.data ? String((const char *)msg.data) : String(), (FsChangeType)msg.client);
+            free(msg.data);
+            continue;
+        }
+#if ESP_FS_WS_WEBSOCKET
+        if (m_websocket) {
+            switch (msg.kind) {
+                case OUTBOX_BROADCAST_TXT:
+                    m_websocket->broadcastTXT(msg.data, msg.length);
+                    break;
+                case OUTBOX_BROADCAST_BIN:
+                    m_websocket->broadcastBIN(msg.data, msg.length);
+                    break;
+                case OUTBOX_SEND_TXT:
+                    m_websocket->sendTXT(msg.client, msg.data, msg.length);
+                    break;
+                case OUTBOX_SEND_BIN:
+                    m_websocket->sendBIN(msg.client, msg.data, msg.length);
+                    break;
+                default:
+                    break;
+            }
+        }
+#endif
+        free(msg.data);
+    }
+}
+
+bool FSWebServer::postEvent(uint8_t id, const uint8_t *data, size_t length, ServerEventType type) {
+    if (!m_serverTask || fromOtherTask()) {
+        return false;
+    }
+    ServerEvent event = {type, id, nullptr, length};
+    if (length) {
+        event.data = (uint8_t *)malloc(length + 1);
+        if (!event.data) {
+            m_droppedEvents++;
+            return false;
+        }
+        memcpy(event.data, data, length);
+        event.data[length] = '\0';
+    }
+    if (!m_events.push(event)) {
+        free(event.data);
+        m_droppedEvents++;
+        return false;
+    }
+    return true;
+}
+
+size_t FSWebServer::dispatchEvents(ServerEventCallbackF cb, size_t maxEvents) {
+    size_t count = 0;
+    ServerEvent event;
+    while (count < maxEvents && m_events.pop(event)) {
+        if (cb) {
+            cb(event);
+        }
+        free(event.data);
+        count++;
+    }
+    return count;
+}
+#endif
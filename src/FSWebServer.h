@@ -6,6 +6,25 @@
 #include "Json.h"
 #include "SerialLog.h"
 #include "Version.h"
+#include "FileCache.h"
+#include "CachePolicy.h"
+#include "RomFs.h"
+#include "FileStreamer.h"
+#include "FileTransfer.h"
+#include "BlockWriter.h"
+#include "UploadSession.h"
+#include "UploadContext.h"
+#include "DirWalker.h"
+#include "ArchiveWriter.h"
+#include "TarExtractor.h"
+#include "HashCache.h"
+#include "DeleteJob.h"
+#include "FileSearch.h"
+#include "ChangeJournal.h"
+#include "DiskUsage.h"
+#include "RetentionManager.h"
+#include "mimetable/mimetable.h"
+#include "HttpUtils.h"
 #include "websocket/WebSocketsServer.h"
 #include <type_traits>
 #include <DNSServer.h>
@@ -27,6 +46,7 @@ using WebServerClass = ESP8266WebServer;
 #include <mdns.h>
 using WebServerClass = WebServer;
 #endif
+#include "ChunkedResponse.h"
 
 class Print;
 
@@ -89,6 +109,51 @@ class Print;
 #define ESP_FS_WS_WEBSOCKET 1
 #endif
 
+// Buffer size used when the library streams file content itself (e.g. byte ranges)
+#ifndef ESP_FS_WS_STREAM_CHUNK
+#define ESP_FS_WS_STREAM_CHUNK 2048
+#endif
+
+// Archive entry of /sync/apply listing the paths to delete (one per line, relative to dir)
+#ifndef ESP_FS_WS_SYNC_DELETE_LIST
+#define ESP_FS_WS_SYNC_DELETE_LIST ".sync-delete"
+#endif
+
+// Minimum interval (ms) of the "ota.progress" events of firmware updates
+#ifndef ESP_FS_WS_OTA_REPORT
+#define ESP_FS_WS_OTA_REPORT 500
+#endif
+
+// Minimum interval (ms) of the "fs.delete" progress events of folder deletions
+#ifndef ESP_FS_WS_DELETE_REPORT
+#define ESP_FS_WS_DELETE_REPORT 500
+#endif
+
+// Matches returned by /search when no limit is given
+#ifndef ESP_FS_WS_SEARCH_LIMIT
+#define ESP_FS_WS_SEARCH_LIMIT 100
+#endif
+
+// Milliseconds of work for one /search request; the rest is asked for with the returned cursor
+#ifndef ESP_FS_WS_SEARCH_BUDGET
+#define ESP_FS_WS_SEARCH_BUDGET 250
+#endif
+
+#if defined(ESP32)
+// Optional FreeRTOS task running run(), started with startServerTask()
+#ifndef ESP_FS_WS_SERVER_TASK
+#define ESP_FS_WS_SERVER_TASK 1
+#endif
+// Slots of the queues between the server task and the application (power of two)
+#ifndef ESP_FS_WS_TASK_QUEUE_SIZE
+#define ESP_FS_WS_TASK_QUEUE_SIZE 16
+#endif
+#endif
+
+#if defined(ESP32) && ESP_FS_WS_SERVER_TASK
+#include "LockFreeQueue.h"
+#endif
+
 #define LIB_URL "https://github.com/cotestatnt/esp-fs-webserver/"
 #define MIN_F -3.4028235E+38
 #define MAX_F 3.4028235E+38
@@ -112,6 +177,25 @@ using FsInfoCallbackF = std::function<void(fsInfo_t *)>;
 using CallbackF = std::function<void(void)>;
 using ConfigSavedCallbackF = std::function<void(const char *)>; // Callback for config file saves
 
+#if defined(ESP32) && ESP_FS_WS_SERVER_TASK
+enum class ServerEventType : uint8_t {
+  WsConnected,
+  WsDisconnected,
+  WsText,
+  WsBinary,
+  User          // Posted with postEvent() from a request handler
+};
+
+// Event handed from the server task to the application (see dispatchEvents())
+struct ServerEvent {
+  ServerEventType type;
+  uint8_t client;     // WebSocket client number, or user defined id
+  uint8_t *data;      // Payload copy (nullptr if empty), freed after the callback
+  size_t length;
+};
+using ServerEventCallbackF = std::function<void(const ServerEvent &)>;
+#endif
+
 class FSWebServer : public WebServerClass {
 protected:
 #if ESP_FS_WS_WEBSOCKET
@@ -128,18 +212,100 @@ protected:
 
   String typeName = "FileSystem";
 
+  // URL -> resolved file lookups, cleared on every change made through /edit
+  FileCache m_fileCache;
+  // Bumped on every filesystem change, used in ETags of files without a valid mtime
+  uint32_t m_fsGeneration = 0;
+  // Content hashes of /sync/manifest, dropped for the paths changed through the library
+  HashCache m_hashCache;
+  // Last changes made through the library or notifyFsChange(), for /changes and "fs.subscribe"
+  ChangeJournal m_changes;
+  // Folders kept within a size / count / age policy by deleting their oldest files
+  RetentionManager m_retention;
+  // Cache-Control rules (from code and from the "_cache" section of config.json)
+  CachePolicy m_cachePolicy;
+  // Optional read-only image embedded in flash, checked before the filesystem
+  RomFs m_romFs;
+#if ESP_FS_WS_TRANSFERS
+  // File responses still being sent, served a slice at a time from run()
+  FileTransferPool m_transfers;
+#endif
+
+#if defined(ESP32) && ESP_FS_WS_SERVER_TASK
+  enum OutboxKind : uint8_t { OUTBOX_BROADCAST_TXT, OUTBOX_BROADCAST_BIN, OUTBOX_SEND_TXT, OUTBOX_SEND_BIN, OUTBOX_FS_CHANGE };
+  struct OutboxMessage {
+    OutboxKind kind;
+    uint8_t client;
+    uint8_t *data;
+    size_t length;
+  };
+  TaskHandle_t m_serverTask = nullptr;
+  volatile bool m_serverTaskStop = false;
+  MpscQueue<OutboxMessage, ESP_FS_WS_TASK_QUEUE_SIZE> m_outbox;   // Any application task -> server task
+  SpscQueue<ServerEvent, ESP_FS_WS_TASK_QUEUE_SIZE> m_events;     // Server task -> application task
+  uint32_t m_droppedEvents = 0;
+
+  static void serverTask(void *arg);
+  bool postToServer(OutboxKind kind, uint8_t client, const uint8_t *data, size_t length);
+  void processOutbox();
+  inline bool fromOtherTask() const { return m_serverTask && xTaskGetCurrentTaskHandle() != m_serverTask; }
+#endif
+#if defined(ESP32) && ESP_FS_WS_STREAM_TASK
+  size_t m_streamBufferSize = ESP_FS_WS_STREAM_BUFFER;
+  bool m_streamPsram = ESP_FS_WS_STREAM_PSRAM;
+#endif
+  FileCacheEntry &resolveFile(const String &url);
+  FileEncoding negotiateEncoding(const FileCacheEntry &entry);
+  /*
+    Called after every change made to the filesystem by the library.
+    path is the changed file or folder ("" if unknown or many: caches are dropped,
+    but nothing is added to the change journal)
+  */
+  void fsChanged(const String &path = String(), FsChangeType type = FS_CHANGE_MODIFIED);
+  // The cache part of fsChanged(): nothing is added to the change journal
+  void dropFsCaches(const String &path);
+  /*
+    fsChanged() from any task: with the server task running, calls from other tasks are
+    queued to it, so the caches and the journal are only touched by the server task
+  */
+  void queueFsChanged(const String &path = String(), FsChangeType type = FS_CHANGE_MODIFIED);
+  String buildFsChangesPayload(uint32_t since) const;
+  void loadCacheRules();
+
+  /*
+    Send validator headers (ETag, Last-Modified, Cache-Control) and answer 304
+    if the client copy is still valid. Returns true if the request is completed
+  */
+  bool checkNotModified(const String &etag, time_t lastModified = 0, const char *cacheControl = ESP_FS_WS_CACHE_DEFAULT);
+  bool serveFile(FileCacheEntry &entry);
+  size_t sendFileContent(File &file, size_t length);
+  bool serveRomFile(const String &url);
+  bool queueTransfer(File &file, size_t length);
+
+  /*
+    True if the request body is handed to the raw callbacks (anything but multipart forms,
+    which go through upload() instead: raw() must not be used then)
+  */
+  inline bool hasRawBody() { return !this->header("Content-Type").startsWith("multipart/"); }
+
   void handleFileRequest();
   void handleFileName();
   void handleIndex();
 
 #if ESP_FS_WS_SETUP
-  File m_uploadFile;
-  uint8_t otaDone = 0;
+  UploadContextPool m_uploads;      // Multipart uploads in progress, one context per connection
+  uint8_t otaDone = 0;             // Firmware update progress (%)
+  uint32_t m_otaReportAt = 0;
   void handleSetup();
   void handleFileUpload();
+  void handleFileUploadDone();
   void checkForUnsupportedPath(String &filename, String &error);
   void update_second();
   void update_first();
+  void update_raw();
+  bool beginOta(size_t size);
+  void writeOta(uint8_t *data, size_t length);
+  void endOta();
 #endif
 
   // edit page, in useful in some situation, but if you need to provide only a
@@ -147,10 +313,43 @@ protected:
 #if ESP_FS_WS_EDIT_HTM
   void deleteContent(String &path);
   void handleFileDelete();
+  void runDeleteJobs();
+  DeleteJob m_deleteJobs[ESP_FS_WS_DELETE_JOBS];   // Folder deletions, a time slice at each run()
+  uint32_t m_deleteJobId = 0;
+  uint32_t m_deleteReportAt = 0;
   void handleFileCreate();
+  void handleBatch();
+  const char *runBatchOp(const cJSON *op);
+  bool copyContent(const String &from, const String &to);
+  /*
+    Create dir and its missing parent folders. Fails if one of them is a file.
+    created gets the topmost folder made ("" if none)
+  */
+  bool makeDirs(const String &dir, String &created);
   void handleFsStatus();
+  enum ListField : uint8_t { LIST_TYPE = 1, LIST_SIZE = 2, LIST_NAME = 4, LIST_TIME = 8 };
   void handleFileList();
   void handleFileEdit();
+  void handleArchive();
+  void handleSearch();
+  void handleChanges();
+  void handleDiskUsage();
+  DiskUsage m_diskUsage;            // Last /du result (or walk in progress)
+  void handleExtract();
+  void handleExtractDone(bool sync = false);
+  void handleSyncManifest();
+  size_t applySyncDeletes(const String &dir);
+  TarExtractor *m_extractor = nullptr;      // Archive being unpacked by /extract
+  ExtractCallbackF m_extractCallback = nullptr;
+#endif
+#if ESP_FS_WS_EDIT && ESP_FS_WS_UPLOAD_SESSIONS
+  void handleUploadStart();
+  void handleUploadChunk();
+  void handleUploadChunkDone();
+  void handleUploadStatus();
+  void handleUploadCommit();
+  void handleUploadAbort();
+  void sendUploadResult(UploadSessionTable::Result result, const UploadSession *session);
 #endif
 
   /*
@@ -172,6 +371,9 @@ private:
   bool m_filesystem_ok = false;
 
   fs::FS *m_filesystem = nullptr;
+#if ESP_FS_WS_EDIT && ESP_FS_WS_UPLOAD_SESSIONS
+  UploadSessionTable m_uploadSessions{m_filesystem};   // Resumable uploads (/upload)
+#endif
   FsInfoCallbackF getFsInfo = nullptr;
   ConfigSavedCallbackF m_configSavedCallback = nullptr; // Callback for config file saves
   IPAddress m_serverIp = IPAddress(192, 168, 4, 1);
@@ -188,6 +390,7 @@ private:
   bool m_pendingSetupFromApClient = false;
   uint8_t m_pendingSetupClientId = 0;
   bool m_releaseSetupWebSocketPending = false;
+  uint32_t m_fsSubscribers = 0;     // Setup WebSocket clients receiving "fs.change" events (bit = client id)
   unsigned long m_pendingSetupRestartAt = 0;
 
   void initSetupWebSocket();
@@ -195,6 +398,8 @@ private:
   void handleSetupWebSocket(uint8_t clientId, WStype_t type, uint8_t *payload, size_t length);
   void handleSetupWebSocketMessage(uint8_t clientId, const uint8_t *data, size_t len);
   void sendSetupWsResponse(uint8_t clientId, const String &reqId, bool ok, const char *name, const String &payload = String(), const String &error = String());
+  // sendSetupWsEvent() to every connected client
+  static constexpr uint8_t SETUP_WS_BROADCAST = 0xFF;
   void sendSetupWsEvent(uint8_t clientId, const char *name, const String &payload = String());
   String buildSetupStatusPayload() const;
   String buildSetupConfigPayload() const;
@@ -258,6 +463,8 @@ public:
       info->fsName = this->typeName;
     };
 #endif
+    m_retention.begin(&fs, [this]() { return fsFreeBytes(); },
+                      [this](const String &path) { notifyFsChange(path, FS_CHANGE_DELETED); });
 
     // Start credential manager
     m_credentialManager = new CredentialManager();
@@ -293,6 +500,9 @@ public:
 #endif
     if (m_dnsServer)
       delete m_dnsServer;
+#if ESP_FS_WS_EDIT_HTM
+    delete m_extractor;
+#endif
 #if ESP_FS_WS_SETUP
     if (setup)
       delete setup; // Only delete if it was lazily initialized
@@ -300,6 +510,14 @@ public:
   }
 
   inline void run() {
+#if defined(ESP32) && ESP_FS_WS_SERVER_TASK
+    // The server task owns the network stack: calls from loop() do nothing
+    if (fromOtherTask())
+      return;
+#endif
+#if ESP_FS_WS_TRANSFERS
+    m_transfers.run();
+#endif
     this->handleClient();
     // Handle websocket events
 #if ESP_FS_WS_WEBSOCKET
@@ -335,6 +553,12 @@ public:
       ESP.restart();
     }
 #endif
+#if ESP_FS_WS_EDIT_HTM
+    runDeleteJobs();
+    if (m_diskUsage.state() == DiskUsage::RUNNING)
+      m_diskUsage.run(ESP_FS_WS_DU_BUDGET);
+#endif
+    m_retention.run(ESP_FS_WS_RETENTION_BUDGET);
 }
 
   /*
@@ -346,6 +570,13 @@ public:
     Get the webserver IP address
   */
   inline IPAddress getServerIP() { return m_serverIp; }
+
+#if ESP_FS_WS_SETUP
+  /*
+    Progress (%) of the firmware update being received by /update (100 once written)
+  */
+  inline uint8_t getOtaProgress() const { return otaDone; }
+#endif
   /*
     Return true if the device is currently running in Access Point mode
   */
@@ -410,6 +641,100 @@ public:
   void printFileList(fs::FS &fs, Print &out, const char *dirname,  uint8_t levels) {
     printFileList(fs, dirname, levels, out);
   }
+  /*
+    Drop cached URL -> file resolutions. Call it after the application
+    creates, removes or renames files that are served by the webserver.
+    With the server task running it can be called from any task
+  */
+  inline void invalidateFileCache() { queueFsChanged(); }
+
+  /*
+    Tell the server that the application changed path (e.g. appended rows to a log, or
+    wrote a file served to the browser): caches are updated and the change is added to
+    the journal read by /changes and "fs.subscribe" clients. With the server task
+    running it can be called from any task
+  */
+  void notifyFsChange(const String &path, FsChangeType type = FS_CHANGE_MODIFIED);
+
+  /*
+    Keep dir within policy: its oldest files (by last write, then by name) are deleted in the
+    background by run(). The files are indexed once, then the index follows the changes made
+    through the library and notifyFsChange(). Up to ESP_FS_WS_RETENTION_DIRS folders
+  */
+  inline bool addRetention(const String &dir, const RetentionPolicy &policy) { return m_retention.add(dir, policy); }
+  inline void removeRetention(const String &dir) { m_retention.remove(dir); }
+
+  /*
+    Call before appending bytes to path: makes room by deleting the oldest files of its
+    retention folder (never path itself), and checks the free space. Returns false if the
+    data doesn't fit, so nothing should be written
+  */
+  inline bool reserveSpace(const String &path, size_t bytes) { return m_retention.reserve(path, bytes); }
+
+  /*
+    Free bytes on the filesystem (SIZE_MAX if the filesystem doesn't tell)
+  */
+  uint64_t fsFreeBytes();
+
+  /*
+    Add a Cache-Control rule for served files and built-in pages ("/setup", "/edit").
+    pattern is a folder prefix ("/assets/") or a glob ("*.css", "/img/icon-*.png"), maxAge is
+    in seconds (0 = always revalidate). First matching rule wins; rules added here take
+    precedence over the "_cache" section of config.json. Examples:
+      server.addCacheRule("/assets/", 31536000, CachePolicy::IMMUTABLE);
+      server.addCacheRule("/data/live-*.json", 0, CachePolicy::NO_STORE);
+  */
+  inline void addCacheRule(const char *pattern, uint32_t maxAge, uint8_t flags = CachePolicy::NONE) {
+    m_cachePolicy.addRule(pattern, maxAge, flags);
+  }
+
+  /*
+    Remove all the Cache-Control rules added with addCacheRule()
+  */
+  inline void clearCacheRules() { m_cachePolicy.clear(); }
+
+  /*
+    Add (or override) the content type used for an extension, e.g. registerMimeType(".wasm", "application/wasm").
+    A compound extension like ".csv.gz" makes matching files be sent as that type with Content-Encoding: gzip
+  */
+  inline bool registerMimeType(const char *ext, const char *type) {
+    bool ok = mimetype::registerType(ext, type);
+    queueFsChanged();
+    return ok;
+  }
+
+#if defined(ESP32) && ESP_FS_WS_STREAM_TASK
+  /*
+    Size of the two buffers used to stream large files (rounded to the filesystem block size)
+    and whether to allocate them in PSRAM
+  */
+  inline void setStreamBuffers(size_t size, bool psram = false) {
+    m_streamBufferSize = size;
+    m_streamPsram = psram;
+#if ESP_FS_WS_TRANSFERS
+    m_transfers.setStreamBuffers(size, psram);
+#endif
+  }
+#endif
+
+#if ESP_FS_WS_SETUP
+  /*
+    Size of the buffer used to collect uploaded data into whole filesystem blocks
+    (default ESP_FS_WS_UPLOAD_BUFFER, 0 writes every chunk straight to the file)
+    and whether to allocate it in PSRAM (ESP32)
+  */
+  inline void setUploadBuffer(size_t size, bool psram = false) {
+    m_uploads.setBuffer(size, psram);
+  }
+#endif
+
+  /*
+    Serve the files of a ROMFS image (generated with tools/romfs.py) straight from flash.
+    Files not found in the image are still looked up on the filesystem
+  */
+  inline void mountRomFs(const RomFsImage &image) { m_romFs = RomFs(&image); }
+  inline void unmountRomFs() { m_romFs = RomFs(); }
+
   /*
     Send a default "OK" reply to client
   */
@@ -478,23 +803,83 @@ public:
 
   inline WebSocketsServer *getWebSocketServer() { return m_websocket; }
 
+  /*
+    WebSocket send helpers. When the server task is running they can be called from any task:
+    the payload is copied and sent by the server task
+  */
   inline bool broadcastWebSocket(const String &payload) {
+#if defined(ESP32) && ESP_FS_WS_SERVER_TASK
+    if (fromOtherTask())
+      return postToServer(OUTBOX_BROADCAST_TXT, 0, (const uint8_t *)payload.c_str(), payload.length());
+#endif
     if (m_websocket)
       return m_websocket->broadcastTXT(payload.c_str());
     return false;
   }
 
   inline bool broadcastWebSocket(const uint8_t *payload, size_t length) {
+#if defined(ESP32) && ESP_FS_WS_SERVER_TASK
+    if (fromOtherTask())
+      return postToServer(OUTBOX_BROADCAST_BIN, 0, payload, length);
+#endif
     if (m_websocket)
       return m_websocket->broadcastBIN(payload, length);
     return false;
   }
 
   inline bool sendWebSocket(uint8_t num, const String &payload) {
+#if defined(ESP32) && ESP_FS_WS_SERVER_TASK
+    if (fromOtherTask())
+      return postToServer(OUTBOX_SEND_TXT, num, (const uint8_t *)payload.c_str(), payload.length());
+#endif
     if (m_websocket)
       return m_websocket->sendTXT(num, payload.c_str());
     return false;
   }
+
+  inline bool sendWebSocket(uint8_t num, const uint8_t *payload, size_t length) {
+#if defined(ESP32) && ESP_FS_WS_SERVER_TASK
+    if (fromOtherTask())
+      return postToServer(OUTBOX_SEND_BIN, num, payload, length);
+#endif
+    if (m_websocket)
+      return m_websocket->sendBIN(num, payload, length);
+    return false;
+  }
+#endif
+
+#if defined(ESP32) && ESP_FS_WS_SERVER_TASK
+  /*
+    Run the whole network stack (HTTP, WebSockets, DNS, transfers) in a dedicated task
+    pinned to core. Call it after begin(); server.run() in loop() then does nothing.
+    Request handlers and the WebSocket event handler run in the server task from now on
+  */
+  bool startServerTask(BaseType_t core = 0, uint32_t stackSize = 8192, UBaseType_t priority = 2);
+
+  /*
+    Stop the server task: run() must be called from loop() again
+  */
+  void stopServerTask();
+
+  inline bool isServerTaskRunning() const { return m_serverTask != nullptr; }
+
+  /*
+    Call cb (in the calling task) for up to maxEvents events queued by the server task:
+    WebSocket connections/messages and postEvent() calls. Returns the number of events handled
+  */
+  size_t dispatchEvents(ServerEventCallbackF cb, size_t maxEvents = ESP_FS_WS_TASK_QUEUE_SIZE);
+
+  /*
+    Queue a User event for dispatchEvents(). Only valid from the server task (e.g. inside
+    a request handler). The payload is copied
+  */
+  bool postEvent(uint8_t id, const uint8_t *data = nullptr, size_t length = 0,
+                 ServerEventType type = ServerEventType::User);
+
+  /*
+    Number of events dropped because the application didn't dispatch them in time
+  */
+  inline uint32_t droppedEvents() const { return m_droppedEvents; }
 #endif
 
 #if ESP_FS_WS_SETUP
@@ -516,6 +901,16 @@ public:
     m_configSavedCallback = callback;
   }
 
+#if ESP_FS_WS_EDIT_HTM
+  /*
+   * Set callback function to be called for every file unpacked by /extract,
+   * with its full path and size
+   */
+  inline void setExtractCallback(ExtractCallbackF callback) {
+    m_extractCallback = callback;
+  }
+#endif
+
   /*
    * Get reference to current config.json file
    */
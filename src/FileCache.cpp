@@ -0,0 +1,61 @@
+#include "FileCache.h"
+
+String FileCacheEntry::path(FileEncoding encoding) const {
+    switch (encoding) {
+        case ENCODING_GZIP:
+            return url + ".gz";
+        case ENCODING_BROTLI:
+            return url + ".br";
+        default:
+            return url;
+    }
+}
+
+bool FileCacheEntry::hasAlternatives() const {
+    uint8_t count = 0;
+    for (const FileVariant &variant : variants) {
+        count += variant.exists ? 1 : 0;
+    }
+    return count > 1;
+}
+
+FileCacheEntry *FileCache::find(const String &url) {
+    for (FileCacheEntry &entry : m_entries) {
+        if (entry.url.length() == 0 || entry.url != url) {
+            continue;
+        }
+        if (m_ttl && millis() - entry.created > m_ttl) {
+            entry.url = "";
+            return nullptr;
+        }
+        entry.lastUsed = ++m_useCounter;
+        return &entry;
+    }
+    return nullptr;
+}
+
+FileCacheEntry &FileCache::insert(const String &url) {
+    FileCacheEntry *slot = &m_entries[0];
+    for (FileCacheEntry &entry : m_entries) {
+        // Prefer a free slot, otherwise the least recently used one
+        if (entry.url.length() == 0) {
+            slot = &entry;
+            break;
+        }
+        if (entry.lastUsed < slot->lastUsed) {
+            slot = &entry;
+        }
+    }
+
+    *slot = FileCacheEntry();
+    slot->url = url;
+    slot->created = millis();
+    slot->lastUsed = ++m_useCounter;
+    return *slot;
+}
+
+void FileCache::clear() {
+    for (FileCacheEntry &entry : m_entries) {
+        entry = FileCacheEntry();
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef FILE_CACHE_H
+#define FILE_CACHE_H
+
+#include <Arduino.h>
+
+// Max number of URL -> resolved file entries kept in RAM
+#ifndef ESP_FS_WS_FILE_CACHE_SIZE
+#define ESP_FS_WS_FILE_CACHE_SIZE 16
+#endif
+
+// Entries older than this (ms) are resolved again against the filesystem,
+// so files written by the application itself are picked up. 0 = never expire
+#ifndef ESP_FS_WS_FILE_CACHE_TTL
+#define ESP_FS_WS_FILE_CACHE_TTL 30000
+#endif
+
+// Stored representations of the same URL: "<url>", "<url>.gz" and "<url>.br"
+enum FileEncoding : uint8_t {
+  ENCODING_IDENTITY = 0,
+  ENCODING_GZIP,
+  ENCODING_BROTLI,
+  ENCODING_COUNT
+};
+
+struct FileVariant {
+  bool exists = false;     // True if the file for this encoding is on the filesystem
+  bool hasMeta = false;    // True once size/mtime have been read from an opened file
+  size_t size = 0;         // File size, valid when hasMeta == true
+  time_t lastWrite = 0;    // File modification time, valid when hasMeta == true
+};
+
+/*
+  Result of resolving a request URL against the filesystem.
+  Negative results (found == false) are cached too, so repeated 404s
+  don't walk the filesystem metadata again.
+*/
+struct FileCacheEntry {
+  String url;                            // Decoded request URL (cache key)
+  const char *contentType = nullptr;     // Content type from the URL extension (flash string)
+  FileVariant variants[ENCODING_COUNT];  // Available encodings of url
+  bool found = false;                    // True if at least one variant exists
+  bool identityGzip = false;             // url itself is gzip data served as its own type (e.g. "x.svg.gz")
+  uint32_t created = 0;                  // millis() when the entry was resolved
+  uint32_t lastUsed = 0;                 // Use counter value for LRU eviction
+
+  // Filesystem path of the given variant
+  String path(FileEncoding encoding) const;
+
+  // True if more than one encoding exists, so the response depends on Accept-Encoding
+  bool hasAlternatives() const;
+};
+
+class FileCache {
+public:
+  /*
+    Return the cached entry for url, or nullptr if missing or expired
+  */
+  FileCacheEntry *find(const String &url);
+
+  /*
+    Reserve a slot for url (evicting the least recently used one) and return it reset
+  */
+  FileCacheEntry &insert(const String &url);
+
+  /*
+    Drop every entry. Called on each filesystem change made through the webserver
+  */
+  void clear();
+
+  inline void setTtl(uint32_t ttl) { m_ttl = ttl; }
+
+private:
+  FileCacheEntry m_entries[ESP_FS_WS_FILE_CACHE_SIZE];
+  uint32_t m_useCounter = 0;
+  uint32_t m_ttl = ESP_FS_WS_FILE_CACHE_TTL;
+};
+
+#endif
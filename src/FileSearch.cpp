@@ -0,0 +1,114 @@
+#include "FileSearch.h"
+
+FileSearch::~FileSearch() {
+    free(m_buf);
+}
+
+bool FileSearch::begin(const String &pattern) {
+    size_t m = pattern.length();
+    if (m == 0 || m > ESP_FS_WS_SEARCH_MAX_PATTERN) {
+        return false;
+    }
+    m_pattern = pattern;
+    for (size_t i = 0; i < 256; i++) {
+        m_shift[i] = m;
+    }
+    for (size_t i = 0; i + 1 < m; i++) {
+        m_shift[(uint8_t)pattern[i]] = m - 1 - i;
+    }
+
+    // Carried over: the last m - 1 bytes (a match may start there) and half an excerpt of context
+    m_keep = m - 1 + ESP_FS_WS_SEARCH_EXCERPT / 2;
+    if (!m_buf) {
+        m_bufSize = ESP_FS_WS_SEARCH_CHUNK + ESP_FS_WS_SEARCH_MAX_PATTERN + ESP_FS_WS_SEARCH_EXCERPT / 2;
+        m_buf = (uint8_t *)malloc(m_bufSize);
+    }
+    m_sliceStart = millis();
+    return m_buf != nullptr;
+}
+
+bool FileSearch::scan(File &file, const MatchCallbackF &onMatch) {
+    if (!m_buf) {
+        return true;
+    }
+    const uint8_t *pattern = (const uint8_t *)m_pattern.c_str();
+    const size_t m = m_pattern.length();
+    const uint8_t last = pattern[m - 1];
+    char line[ESP_FS_WS_SEARCH_EXCERPT + 1];
+
+    size_t len = 0;         // Bytes in the buffer
+    size_t from = 0;        // First position not searched yet
+    uint32_t base = 0;      // Offset of m_buf[0] from the scan start
+    uint32_t start = file.position();
+    while (true) {
+        size_t n = file.read(m_buf + len, m_bufSize - len);
+        if (n == 0 || n > m_bufSize - len) {
+            break;
+        }
+        len += n;
+
+        size_t pos = from;
+        while (pos + m <= len) {
+            uint8_t c = m_buf[pos + m - 1];
+            if (c == last && memcmp(m_buf + pos, pattern, m - 1) == 0) {
+                excerpt(pos, len, line);
+                if (!onMatch(start + base + pos, line)) {
+                    m_resume = start + base + pos + m;
+                    return false;
+                }
+                pos += m;
+                continue;
+            }
+            pos += m_shift[c];
+        }
+
+        // Carry the tail over; pos > len - m, so nothing before drop is still to be searched
+        size_t drop = len > m_keep ? len - m_keep : 0;
+        if (drop > pos) {
+            drop = pos;
+        }
+        memmove(m_buf, m_buf + drop, len - drop);
+        len -= drop;
+        base += drop;
+        from = pos - drop;
+        if (expired()) {
+            m_resume = start + base + from;
+            return false;
+        }
+        yieldIfDue();
+    }
+    return true;
+}
+
+void FileSearch::setBudget(uint32_t budgetMs) {
+    m_budgetStart = millis();
+    m_budget = budgetMs;
+}
+
+bool FileSearch::expired() const {
+    return m_budget && millis() - m_budgetStart >= m_budget;
+}
+
+void FileSearch::excerpt(size_t pos, size_t len, char *line) const {
+    size_t begin = pos;
+    while (begin > 0 && m_buf[begin - 1] != '\n' && pos - begin < ESP_FS_WS_SEARCH_EXCERPT / 2) {
+        begin--;
+    }
+    size_t end = pos;
+    while (end < len && m_buf[end] != '\n' && m_buf[end] != '\r' && end - begin < ESP_FS_WS_SEARCH_EXCERPT) {
+        end++;
+    }
+    memcpy(line, m_buf + begin, end - begin);
+    line[end - begin] = '\0';
+}
+
+void FileSearch::yieldIfDue() {
+    if (millis() - m_sliceStart >= ESP_FS_WS_SEARCH_YIELD) {
+        // A tick of sleep lets the idle task (and its watchdog) and the network stack run
+        delay(1);
+        m_sliceStart = millis();
+    }
+    else {
+        yield();
+    }
+}
@@ -0,0 +1,91 @@
+#ifndef FILE_SEARCH_H
+#define FILE_SEARCH_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <functional>
+
+// Bytes read from a file at a time by /search
+#ifndef ESP_FS_WS_SEARCH_CHUNK
+#define ESP_FS_WS_SEARCH_CHUNK 1024
+#endif
+
+// Longest "contains" text accepted
+#ifndef ESP_FS_WS_SEARCH_MAX_PATTERN
+#define ESP_FS_WS_SEARCH_MAX_PATTERN 64
+#endif
+
+// Max length of the line excerpt reported with every match
+#ifndef ESP_FS_WS_SEARCH_EXCERPT
+#define ESP_FS_WS_SEARCH_EXCERPT 96
+#endif
+
+// Milliseconds of searching before the task sleeps for a tick (idle task and watchdog)
+#ifndef ESP_FS_WS_SEARCH_YIELD
+#define ESP_FS_WS_SEARCH_YIELD 50
+#endif
+
+/*
+  Substring search in file contents with a fixed buffer (Boyer-Moore-Horspool).
+  The file is read ESP_FS_WS_SEARCH_CHUNK bytes at a time; the end of each chunk is kept
+  in front of the next one, so matches across two chunks are found (once) and the excerpt
+  has some text before the match:
+
+    FileSearch search;
+    search.begin("tag=0A1B");
+    search.scan(file, [](uint32_t offset, const char *line) {
+      ...
+      return true;   // false to stop
+    });
+*/
+class FileSearch {
+public:
+  // offset of the match in the file, line is the text around it (up to ESP_FS_WS_SEARCH_EXCERPT chars)
+  using MatchCallbackF = std::function<bool(uint32_t offset, const char *line)>;
+
+  ~FileSearch();
+
+  /*
+    Set the text to search and allocate the buffer. Returns false if pattern is empty,
+    too long or there is no memory
+  */
+  bool begin(const String &pattern);
+
+  /*
+    Scan file from its current position. Returns false if stopped by onMatch or because
+    the time set with setBudget() is over: the scan can go on later from resumeOffset()
+  */
+  bool scan(File &file, const MatchCallbackF &onMatch);
+
+  /*
+    Stop scanning budgetMs from now (0: no limit)
+  */
+  void setBudget(uint32_t budgetMs);
+  bool expired() const;
+
+  /*
+    File offset to resume from after scan() returned false (the byte after the last match
+    reported, or the first byte not searched yet when the time was over)
+  */
+  inline uint32_t resumeOffset() const { return m_resume; }
+
+  /*
+    Sleep for a tick if the search has been running for ESP_FS_WS_SEARCH_YIELD ms
+  */
+  void yieldIfDue();
+
+private:
+  void excerpt(size_t pos, size_t len, char *line) const;
+
+  uint8_t *m_buf = nullptr;
+  size_t m_bufSize = 0;
+  size_t m_keep = 0;          // Bytes carried over to the next chunk
+  String m_pattern;
+  uint8_t m_shift[256];       // Horspool bad character shifts
+  uint32_t m_sliceStart = 0;
+  uint32_t m_budgetStart = 0;
+  uint32_t m_budget = 0;
+  uint32_t m_resume = 0;
+};
+
+#endif
@@ -0,0 +1,162 @@
+#include "FileStreamer.h"
+#include "SerialLog.h"
+
+#if defined(ESP32)
+
+FileStreamer::FileStreamer(size_t bufferSize, bool psram) : m_psram(psram) {
+    // Whole filesystem blocks: aligned reads never touch a block twice
+    if (bufferSize < ESP_FS_WS_FS_BLOCK_SIZE) {
+        bufferSize = ESP_FS_WS_FS_BLOCK_SIZE;
+    }
+    m_bufferSize = (bufferSize / ESP_FS_WS_FS_BLOCK_SIZE) * ESP_FS_WS_FS_BLOCK_SIZE;
+}
+
+FileStreamer::~FileStreamer() {
+    end();
+}
+
+uint8_t *FileStreamer::allocBuffer() {
+    uint8_t *buf = nullptr;
+    if (m_psram) {
+        buf = (uint8_t *)heap_caps_malloc(m_bufferSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (!buf) {
+        buf = (uint8_t *)malloc(m_bufferSize);
+    }
+    return buf;
+}
+
+bool FileStreamer::begin(File &file, size_t length) {
+    end();
+    m_buffers[0] = allocBuffer();
+    m_buffers[1] = allocBuffer();
+    m_free = xQueueCreate(2, sizeof(uint8_t));
+    m_full = xQueueCreate(2, sizeof(Slot));
+    m_done = xSemaphoreCreateBinary();
+    if (!m_buffers[0] || !m_buffers[1] || !m_free || !m_full || !m_done) {
+        log_error("Not enough memory for stream buffers");
+        end();
+        return false;
+    }
+
+    m_file = &file;
+    m_remaining = length;
+    m_stop = false;
+    m_finished = false;
+    for (uint8_t i = 0; i < 2; i++) {
+        xQueueSend(m_free, &i, 0);
+    }
+
+    // Same priority as the caller: the reader runs whenever the writer blocks on the socket
+    if (xTaskCreatePinnedToCore(readerTask, "fsReader", ESP_FS_WS_STREAM_TASK_STACK, this,
+                                uxTaskPriorityGet(nullptr), &m_task, ESP_FS_WS_STREAM_TASK_CORE) != pdPASS) {
+        log_error("Stream reader task not started");
+        m_task = nullptr;
+        end();
+        return false;
+    }
+    return true;
+}
+
+void FileStreamer::readerTask(void *arg) {
+    FileStreamer *self = static_cast<FileStreamer *>(arg);
+    self->readLoop();
+    xSemaphoreGive(self->m_done);
+    vTaskDelete(nullptr);
+}
+
+void FileStreamer::readLoop() {
+    // First read ends on a block boundary (e.g. a Range starting mid-block)
+    size_t toBoundary = m_bufferSize - (m_file->position() % ESP_FS_WS_FS_BLOCK_SIZE);
+    size_t chunk = toBoundary;
+    while (true) {
+        uint8_t index;
+        xQueueReceive(m_free, &index, portMAX_DELAY);
+        if (m_stop) {
+            return;
+        }
+
+        size_t want = m_remaining < chunk ? m_remaining : chunk;
+        Slot slot = {index, want ? m_file->read(m_buffers[index], want) : 0};
+        m_remaining -= slot.length;
+        chunk = m_bufferSize;
+        // An empty slot marks the end of data (or a read error)
+        xQueueSend(m_full, &slot, portMAX_DELAY);
+        if (slot.length == 0) {
+            return;
+        }
+    }
+}
+
+const uint8_t *FileStreamer::acquire(size_t &len, TickType_t wait) {
+    len = 0;
+    if (!m_full || m_finished || m_current >= 0) {
+        return nullptr;
+    }
+    Slot slot;
+    if (xQueueReceive(m_full, &slot, wait) != pdTRUE) {
+        return nullptr;
+    }
+    if (slot.length == 0) {
+        m_finished = true;
+        return nullptr;
+    }
+    m_current = slot.index;
+    len = slot.length;
+    return m_buffers[slot.index];
+}
+
+void FileStreamer::release() {
+    if (m_current >= 0) {
+        uint8_t index = (uint8_t)m_current;
+        m_current = -1;
+        xQueueSend(m_free, &index, 0);
+    }
+}
+
+void FileStreamer::end() {
+    if (m_task) {
+        // Wake the reader if it is waiting for a free buffer, then wait for it to exit
+        m_stop = true;
+        uint8_t dummy = 0;
+        xQueueSend(m_free, &dummy, 0);
+        xSemaphoreTake(m_done, portMAX_DELAY);
+        m_task = nullptr;
+    }
+    if (m_free) {
+        vQueueDelete(m_free);
+        m_free = nullptr;
+    }
+    if (m_full) {
+        vQueueDelete(m_full);
+        m_full = nullptr;
+    }
+    if (m_done) {
+        vSemaphoreDelete(m_done);
+        m_done = nullptr;
+    }
+    for (uint8_t i = 0; i < 2; i++) {
+        free(m_buffers[i]);
+        m_buffers[i] = nullptr;
+    }
+    m_current = -1;
+    m_file = nullptr;
+}
+
+size_t FileStreamer::stream(Print &out) {
+    size_t sent = 0;
+    size_t len;
+    while (const uint8_t *buf = acquire(len)) {
+        size_t written = out.write(buf, len);
+        release();
+        sent += written;
+        if (written != len) {
+            log_debug("Client disconnected after %u bytes", sent);
+            break;
+        }
+    }
+    end();
+    return sent;
+}
+
+#endif  // ESP32
@@ -0,0 +1,129 @@
+#ifndef FILE_STREAMER_H
+#define FILE_STREAMER_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+// Erase block size of the filesystem partition (LittleFS/FFat on ESP32 use the 4 KB flash sector).
+// Stream reads are aligned to it, so every read maps to whole blocks
+#ifndef ESP_FS_WS_FS_BLOCK_SIZE
+#define ESP_FS_WS_FS_BLOCK_SIZE 4096
+#endif
+
+#if defined(ESP32)
+
+// Stream large files with a background reader task and two buffers (ESP32 only)
+#ifndef ESP_FS_WS_STREAM_TASK
+#define ESP_FS_WS_STREAM_TASK 1
+#endif
+
+// Size of each of the two buffers (rounded to a multiple of ESP_FS_WS_FS_BLOCK_SIZE)
+#ifndef ESP_FS_WS_STREAM_BUFFER
+#define ESP_FS_WS_STREAM_BUFFER 4096
+#endif
+
+// Allocate the buffers in PSRAM when available
+#ifndef ESP_FS_WS_STREAM_PSRAM
+#define ESP_FS_WS_STREAM_PSRAM 0
+#endif
+
+// Smaller responses are sent inline: starting a task isn't worth it
+#ifndef ESP_FS_WS_STREAM_TASK_MIN
+#define ESP_FS_WS_STREAM_TASK_MIN 16384
+#endif
+
+#ifndef ESP_FS_WS_STREAM_TASK_STACK
+#define ESP_FS_WS_STREAM_TASK_STACK 3072
+#endif
+
+// Core of the reader task (tskNO_AFFINITY = any)
+#ifndef ESP_FS_WS_STREAM_TASK_CORE
+#define ESP_FS_WS_STREAM_TASK_CORE tskNO_AFFINITY
+#endif
+
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+/*
+  Double buffered file reader.
+  A reader task fills one buffer from flash while the caller writes the other one to the
+  socket, so flash reads and TCP transmission overlap:
+
+    FileStreamer streamer(4096, false);
+    if (streamer.begin(file, length)) {
+      size_t len;
+      while (const uint8_t *buf = streamer.acquire(len)) {   // nullptr at end of data
+        client.write(buf, len);
+        streamer.release();
+      }
+      streamer.end();
+    }
+
+  The file must not be used by the caller between begin() and end().
+*/
+class FileStreamer {
+public:
+  FileStreamer(size_t bufferSize = ESP_FS_WS_STREAM_BUFFER, bool psram = ESP_FS_WS_STREAM_PSRAM);
+  ~FileStreamer();
+
+  FileStreamer(const FileStreamer &) = delete;
+  FileStreamer &operator=(const FileStreamer &) = delete;
+
+  /*
+    Allocate the buffers and start reading length bytes from the current file position.
+    Returns false (nothing read) if memory or the task can't be allocated
+  */
+  bool begin(File &file, size_t length);
+
+  /*
+    Wait up to wait ticks for the next filled buffer. Returns nullptr at the end of data,
+    on read errors or on timeout (check finished() to tell them apart)
+  */
+  const uint8_t *acquire(size_t &len, TickType_t wait = portMAX_DELAY);
+
+  /*
+    Give the buffer returned by acquire() back to the reader
+  */
+  void release();
+
+  /*
+    Stop the reader (also before the end of data) and free everything
+  */
+  void end();
+
+  /*
+    Blocking helper: write everything to out. Returns the number of bytes written
+  */
+  size_t stream(Print &out);
+
+  inline bool finished() const { return m_finished; }
+
+private:
+  struct Slot {
+    uint8_t index;
+    size_t length;
+  };
+
+  size_t m_bufferSize;
+  bool m_psram;
+  uint8_t *m_buffers[2] = {nullptr, nullptr};
+  File *m_file = nullptr;
+  size_t m_remaining = 0;
+  QueueHandle_t m_free = nullptr;      // Empty buffers, reader side
+  QueueHandle_t m_full = nullptr;      // Filled buffers, writer side
+  SemaphoreHandle_t m_done = nullptr;  // Given by the reader task on exit
+  TaskHandle_t m_task = nullptr;
+  volatile bool m_stop = false;
+  bool m_finished = false;
+  int16_t m_current = -1;              // Buffer held by the caller
+
+  static void readerTask(void *arg);
+  void readLoop();
+  uint8_t *allocBuffer();
+};
+
+#endif  // ESP32
+#endif
@@ -0,0 +1,182 @@
+#include "FileTransfer.h"
+#include "SerialLog.h"
+
+#if ESP_FS_WS_TRANSFERS
+
+#if defined(ESP32)
+#include <lwip/sockets.h>
+#endif
+
+FileTransferPool::~FileTransferPool() {
+    abortAll();
+}
+
+bool FileTransferPool::add(WiFiClient &client, File &file, size_t length) {
+    for (Transfer &transfer : m_transfers) {
+        if (transfer.active) {
+            continue;
+        }
+        if (!m_buffer) {
+            m_buffer = (uint8_t *)malloc(ESP_FS_WS_TRANSFER_SLICE);
+            if (!m_buffer) {
+                return false;
+            }
+        }
+        // Copies share the socket / file handle, which stay open while referenced here
+        transfer.client = client;
+        transfer.file = file;
+#if defined(ESP8266)
+        // Don't wait for the ACK of each write
+        transfer.client.setSync(false);
+#endif
+        transfer.remaining = length;
+        transfer.lastProgress = millis();
+        transfer.active = true;
+#if defined(ESP32) && ESP_FS_WS_STREAM_TASK
+        if (length >= ESP_FS_WS_STREAM_TASK_MIN && m_streamers < ESP_FS_WS_TRANSFER_STREAMERS) {
+            transfer.streamer = new FileStreamer(m_streamBufferSize, m_streamPsram);
+            if (transfer.streamer->begin(transfer.file, length)) {
+                m_streamers++;
+            } else {
+                delete transfer.streamer;
+                transfer.streamer = nullptr;
+            }
+        }
+#endif
+        m_active++;
+        log_debug("Transfer of %u bytes queued (%u active)", length, m_active);
+        return true;
+    }
+    return false;
+}
+
+void FileTransferPool::run() {
+    if (!m_active) {
+        return;
+    }
+    for (Transfer &transfer : m_transfers) {
+        if (transfer.active) {
+            serve(transfer);
+        }
+    }
+    if (!m_active && m_buffer) {
+        free(m_buffer);
+        m_buffer = nullptr;
+    }
+}
+
+// Room in the socket send buffer: writing at most this much doesn't block
+size_t FileTransferPool::writable(WiFiClient &client) {
+#if defined(ESP8266)
+    return client.availableForWrite();
+#elif defined(ESP32)
+    int fd = client.fd();
+    if (fd < 0) {
+        return 0;
+    }
+    fd_set set;
+    FD_ZERO(&set);
+    FD_SET(fd, &set);
+    struct timeval timeout = {0, 0};
+    return select(fd + 1, nullptr, &set, nullptr, &timeout) > 0 ? ESP_FS_WS_TRANSFER_SLICE : 0;
+#endif
+}
+
+void FileTransferPool::serve(Transfer &transfer) {
+    if (!transfer.client.connected()) {
+        log_debug("Transfer aborted, client disconnected");
+        finish(transfer);
+        return;
+    }
+    size_t room = writable(transfer.client);
+    if (room == 0) {
+        if (millis() - transfer.lastProgress > ESP_FS_WS_TRANSFER_TIMEOUT) {
+            log_debug("Transfer timeout, %u bytes left", transfer.remaining);
+            finish(transfer);
+        }
+        return;
+    }
+    if (room > ESP_FS_WS_TRANSFER_SLICE) {
+        room = ESP_FS_WS_TRANSFER_SLICE;
+    }
+
+    size_t written = 0;
+#if defined(ESP32) && ESP_FS_WS_STREAM_TASK
+    if (transfer.streamer) {
+        if (!transfer.pending) {
+            transfer.pending = transfer.streamer->acquire(transfer.pendingLen, 0);
+            if (!transfer.pending) {
+                if (transfer.streamer->finished()) {
+                    finish(transfer);
+                }
+                return;   // Next block not read yet
+            }
+        }
+        size_t len = transfer.pendingLen < room ? transfer.pendingLen : room;
+        written = transfer.client.write(transfer.pending, len);
+        transfer.pending += written;
+        transfer.pendingLen -= written;
+        if (transfer.pendingLen == 0) {
+            transfer.pending = nullptr;
+            transfer.streamer->release();
+        }
+    }
+    else
+#endif
+    {
+        size_t len = transfer.remaining < room ? transfer.remaining : room;
+        size_t read = transfer.file.read(m_buffer, len);
+        if (read == 0) {
+            log_error("Transfer read error, %u bytes left", transfer.remaining);
+            finish(transfer);
+            return;
+        }
+        written = transfer.client.write(m_buffer, read);
+        if (written < read) {
+            // Rewind what the socket didn't take
+            transfer.file.seek(transfer.file.position() - (read - written), SeekSet);
+        }
+    }
+
+    if (written) {
+        transfer.remaining -= written;
+        transfer.lastProgress = millis();
+    }
+    if (transfer.remaining == 0) {
+        finish(transfer);
+    }
+}
+
+void FileTransferPool::finish(Transfer &transfer) {
+#if defined(ESP32) && ESP_FS_WS_STREAM_TASK
+    if (transfer.streamer) {
+        transfer.streamer->end();
+        delete transfer.streamer;
+        transfer.streamer = nullptr;
+        m_streamers--;
+    }
+    transfer.pending = nullptr;
+    transfer.pendingLen = 0;
+#endif
+    transfer.file.close();
+    transfer.file = File();
+    // Remaining bytes (if any) would leave the client waiting for Content-Length: close it
+    if (transfer.remaining) {
+        transfer.client.stop();
+    }
+    transfer.client = WiFiClient();
+    transfer.active = false;
+    m_active--;
+}
+
+void FileTransferPool::abortAll() {
+    for (Transfer &transfer : m_transfers) {
+        if (transfer.active) {
+            finish(transfer);
+        }
+    }
+    free(m_buffer);
+    m_buffer = nullptr;
+}
+
+#endif  // ESP_FS_WS_TRANSFERS
@@ -0,0 +1,106 @@
+#ifndef FILE_TRANSFER_H
+#define FILE_TRANSFER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "FileStreamer.h"
+
+#if defined(ESP8266)
+#include <ESP8266WiFi.h>
+#elif defined(ESP32)
+#include <WiFi.h>
+#endif
+
+// Max number of file responses sent in background from run(). 0 = send every file inside its handler
+#ifndef ESP_FS_WS_TRANSFERS
+#define ESP_FS_WS_TRANSFERS 4
+#endif
+
+// Bytes written to each client on every run() call
+#ifndef ESP_FS_WS_TRANSFER_SLICE
+#define ESP_FS_WS_TRANSFER_SLICE 2048
+#endif
+
+// A transfer without progress for this long (ms) is dropped
+#ifndef ESP_FS_WS_TRANSFER_TIMEOUT
+#define ESP_FS_WS_TRANSFER_TIMEOUT 10000
+#endif
+
+#if defined(ESP32) && ESP_FS_WS_STREAM_TASK
+// Transfers that may use a double buffered background reader at the same time
+// (each one takes two stream buffers and a task stack)
+#ifndef ESP_FS_WS_TRANSFER_STREAMERS
+#define ESP_FS_WS_TRANSFER_STREAMERS 1
+#endif
+#endif
+
+#if ESP_FS_WS_TRANSFERS
+
+/*
+  File responses in flight.
+  The request handler sends the headers, then hands the client and the open file over
+  with add() and returns at once. run() writes at most one slice per transfer, and only
+  to sockets with room in their send buffer, so a slow client never blocks the loop.
+*/
+class FileTransferPool {
+public:
+  ~FileTransferPool();
+
+  /*
+    Queue length bytes of file (from its current position) for client.
+    Returns false if all slots are busy: the caller sends the content itself
+  */
+  bool add(WiFiClient &client, File &file, size_t length);
+
+  /*
+    Serve a slice of each active transfer. Call it from the main loop
+  */
+  void run();
+
+  /*
+    Drop every transfer (clients are disconnected)
+  */
+  void abortAll();
+
+  inline uint8_t active() const { return m_active; }
+
+#if defined(ESP32) && ESP_FS_WS_STREAM_TASK
+  /*
+    Buffers of the background readers started by the next add() calls
+  */
+  inline void setStreamBuffers(size_t size, bool psram) {
+    m_streamBufferSize = size;
+    m_streamPsram = psram;
+  }
+#endif
+
+private:
+  struct Transfer {
+    WiFiClient client;
+    File file;
+    size_t remaining = 0;
+    uint32_t lastProgress = 0;
+    bool active = false;
+#if defined(ESP32) && ESP_FS_WS_STREAM_TASK
+    FileStreamer *streamer = nullptr;   // Background reader, for large files
+    const uint8_t *pending = nullptr;   // Acquired buffer not yet fully written
+    size_t pendingLen = 0;
+#endif
+  };
+
+  Transfer m_transfers[ESP_FS_WS_TRANSFERS];
+  uint8_t m_active = 0;
+#if defined(ESP32) && ESP_FS_WS_STREAM_TASK
+  uint8_t m_streamers = 0;
+  size_t m_streamBufferSize = ESP_FS_WS_STREAM_BUFFER;
+  bool m_streamPsram = ESP_FS_WS_STREAM_PSRAM;
+#endif
+  uint8_t *m_buffer = nullptr;          // Slice buffer shared by all the transfers
+
+  void serve(Transfer &transfer);
+  void finish(Transfer &transfer);
+  static size_t writable(WiFiClient &client);
+};
+
+#endif  // ESP_FS_WS_TRANSFERS
+#endif
@@ -0,0 +1,47 @@
+#include "HashCache.h"
+#include "Crc32.h"
+
+uint32_t HashCache::get(const String &path, File &file, uint8_t *buf, size_t bufSize) {
+    uint32_t size = file.size();
+    time_t mtime = file.getLastWrite();
+    for (const Entry &entry : m_entries) {
+        if (entry.path == path) {
+            if (entry.size == size && entry.mtime == mtime) {
+                return entry.crc;
+            }
+            break;
+        }
+    }
+
+    uint32_t crc = 0;
+    size_t n;
+    while ((n = file.read(buf, bufSize)) > 0) {
+        crc = Crc32::update(crc, buf, n);
+        yield();
+    }
+
+#if ESP_FS_WS_HASH_CACHE
+    invalidate(path);
+    if (m_entries.size() >= ESP_FS_WS_HASH_CACHE) {
+        m_entries.erase(m_entries.begin());
+    }
+    m_entries.push_back({path, size, mtime, crc});
+#endif
+    return crc;
+}
+
+void HashCache::invalidate(const String &path) {
+    if (path.isEmpty() || path == "/") {
+        m_entries.clear();
+        return;
+    }
+    String folder = path.endsWith("/") ? path : path + "/";
+    for (size_t i = 0; i < m_entries.size();) {
+        if (m_entries[i].path == path || m_entries[i].path.startsWith(folder)) {
+            m_entries.erase(m_entries.begin() + i);
+        }
+        else {
+            i++;
+        }
+    }
+}
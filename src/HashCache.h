@@ -0,0 +1,43 @@
+#ifndef HASH_CACHE_H
+#define HASH_CACHE_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <vector>
+
+// Content hashes remembered for /sync/manifest (0 disables the cache)
+#ifndef ESP_FS_WS_HASH_CACHE
+#define ESP_FS_WS_HASH_CACHE 128
+#endif
+
+/*
+  CRC32 of file contents, so a manifest doesn't read every file again.
+  An entry is used only if size and modification time still match, and it is dropped
+  by invalidate() whenever the library changes the file (or a folder containing it).
+  When full, the oldest entry is replaced.
+*/
+class HashCache {
+public:
+  /*
+    CRC32 of the file at path, from the cache or reading file (from its current position)
+  */
+  uint32_t get(const String &path, File &file, uint8_t *buf, size_t bufSize);
+
+  /*
+    Forget path and everything below it. "" or "/" forgets everything
+  */
+  void invalidate(const String &path);
+
+  inline void clear() { m_entries.clear(); }
+
+private:
+  struct Entry {
+    String path;
+    uint32_t size;
+    time_t mtime;
+    uint32_t crc;
+  };
+  std::vector<Entry> m_entries;
+};
+
+#endif
@@ -0,0 +1,219 @@
+#include "HttpUtils.h"
+
+namespace HttpUtils {
+
+static const char s_months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+// Days since 1970-01-01 for a proleptic Gregorian date (H. Hinnant's algorithm).
+// Avoids mktime(), which depends on the configured local timezone
+static int32_t daysFromCivil(int32_t y, uint32_t m, uint32_t d) {
+    y -= m <= 2;
+    const int32_t era = (y >= 0 ? y : y - 399) / 400;
+    const uint32_t yoe = static_cast<uint32_t>(y - era * 400);
+    const uint32_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int32_t>(doe) - 719468;
+}
+
+String makeEtag(uint32_t hash) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "\"%08lx\"", (unsigned long)hash);
+    return String(buf);
+}
+
+String makeEtag(size_t size, time_t mtime, uint32_t generation, const char *suffix) {
+    char buf[48];
+    const char *sep = suffix ? "-" : "";
+    suffix = suffix ? suffix : "";
+    if (mtime >= MIN_VALID_TIME) {
+        snprintf(buf, sizeof(buf), "W/\"%lx-%lx%s%s\"", (unsigned long)size, (unsigned long)mtime, sep, suffix);
+    } else {
+        snprintf(buf, sizeof(buf), "W/\"%lx-g%lx%s%s\"", (unsigned long)size, (unsigned long)generation, sep, suffix);
+    }
+    return String(buf);
+}
+
+String formatHttpDate(time_t t) {
+    struct tm tmUtc;
+    char buf[32];
+    gmtime_r(&t, &tmUtc);
+    strftime(buf, sizeof(buf), "%a, %d %b %Y %H:%M:%S GMT", &tmUtc);
+    return String(buf);
+}
+
+time_t parseHttpDate(const char *date) {
+    if (!date) {
+        return 0;
+    }
+    int day, year, hour, minute, second;
+    char month[4] = {0};
+    if (sscanf(date, "%*3s, %2d %3s %4d %2d:%2d:%2d", &day, month, &year, &hour, &minute, &second) != 6) {
+        return 0;
+    }
+    const char *pos = strstr(s_months, month);
+    if (!pos || strlen(month) != 3 || (pos - s_months) % 3 != 0) {
+        return 0;
+    }
+    uint32_t mon = (pos - s_months) / 3 + 1;
+    int32_t days = daysFromCivil(year, mon, day);
+    return static_cast<time_t>(days) * 86400 + hour * 3600 + minute * 60 + second;
+}
+
+bool etagMatches(const String &ifNoneMatch, const String &etag) {
+    if (ifNoneMatch.length() == 0 || etag.length() == 0) {
+        return false;
+    }
+    // Weak comparison: ignore the W/ prefix on both sides
+    String opaque = etag.startsWith("W/") ? etag.substring(2) : etag;
+
+    int start = 0;
+    while (start < (int)ifNoneMatch.length()) {
+        int end = ifNoneMatch.indexOf(',', start);
+        if (end < 0) {
+            end = ifNoneMatch.length();
+        }
+        String candidate = ifNoneMatch.substring(start, end);
+        candidate.trim();
+        if (candidate == "*") {
+            return true;
+        }
+        if (candidate.startsWith("W/")) {
+            candidate.remove(0, 2);
+        }
+        if (candidate == opaque) {
+            return true;
+        }
+        start = end + 1;
+    }
+    return false;
+}
+
+RangeResult parseRange(const String &range, size_t size, size_t &start, size_t &length) {
+    String spec = range;
+    spec.trim();
+    if (!spec.startsWith("bytes=") || spec.indexOf(',') != -1) {
+        return RangeResult::None;
+    }
+    spec.remove(0, 6);
+    spec.trim();
+    int dash = spec.indexOf('-');
+    if (dash < 0) {
+        return RangeResult::None;
+    }
+
+    String first = spec.substring(0, dash);
+    String last = spec.substring(dash + 1);
+    first.trim();
+    last.trim();
+    char *end = nullptr;
+
+    if (first.length() == 0) {
+        // Suffix range: the last N bytes
+        unsigned long long suffix = strtoull(last.c_str(), &end, 10);
+        if (!isdigit((unsigned char)last[0]) || *end != '\0') {
+            return RangeResult::None;
+        }
+        if (suffix == 0 || size == 0) {
+            return RangeResult::Unsatisfiable;
+        }
+        length = suffix < size ? static_cast<size_t>(suffix) : size;
+        start = size - length;
+        return RangeResult::Satisfiable;
+    }
+
+    unsigned long long from = strtoull(first.c_str(), &end, 10);
+    if (!isdigit((unsigned char)first[0]) || *end != '\0') {
+        return RangeResult::None;
+    }
+    unsigned long long to = size ? size - 1 : 0;
+    if (last.length()) {
+        to = strtoull(last.c_str(), &end, 10);
+        if (!isdigit((unsigned char)last[0]) || *end != '\0' || to < from) {
+            return RangeResult::None;
+        }
+        if (size && to > size - 1) {
+            to = size - 1;
+        }
+    }
+    if (from >= size) {
+        return RangeResult::Unsatisfiable;
+    }
+    start = static_cast<size_t>(from);
+    length = static_cast<size_t>(to - from + 1);
+    return RangeResult::Satisfiable;
+}
+
+bool ifRangeMatches(const String &ifRange, const String &etag, time_t lastModified) {
+    String value = ifRange;
+    value.trim();
+    if (value.startsWith("W/")) {
+        return false;
+    }
+    if (value.startsWith("\"")) {
+        // Strong comparison: a weak ETag never matches
+        return !etag.startsWith("W/") && value == etag;
+    }
+    return lastModified >= MIN_VALID_TIME && parseHttpDate(value.c_str()) == lastModified;
+}
+
+bool acceptsEncoding(const String &acceptEncoding, const char *coding) {
+    bool wildcard = false;
+    int start = 0;
+    while (start < (int)acceptEncoding.length()) {
+        int end = acceptEncoding.indexOf(',', start);
+        if (end < 0) {
+            end = acceptEncoding.length();
+        }
+        String item = acceptEncoding.substring(start, end);
+        start = end + 1;
+
+        // "gzip;q=0.5" -> name "gzip", q 0.5
+        float q = 1.0f;
+        int semi = item.indexOf(';');
+        if (semi >= 0) {
+            int qPos = item.indexOf("q=", semi);
+            if (qPos >= 0) {
+                q = item.substring(qPos + 2).toFloat();
+            }
+            item.remove(semi);
+        }
+        item.trim();
+        if (item.equalsIgnoreCase(coding)) {
+            // An explicit entry wins over "*"
+            return q > 0.0f;
+        }
+        if (item == "*") {
+            wildcard = q > 0.0f;
+        }
+    }
+    return wildcard;
+}
+
+bool globMatch(const char *pattern, const char *text) {
+    // Iterative match with a single backtracking point: on mismatch, the last '*' absorbs one more character
+    const char *star = nullptr;
+    const char *resume = nullptr;
+    while (*text) {
+        if (*pattern == '*') {
+            star = pattern++;
+            resume = text;
+        }
+        else if (*pattern == '?' || *pattern == *text) {
+            pattern++;
+            text++;
+        }
+        else if (star) {
+            pattern = star + 1;
+            text = ++resume;
+        }
+        else {
+            return false;
+        }
+    }
+    while (*pattern == '*') {
+        pattern++;
+    }
+    return *pattern == '\0';
+}
+
+}  // namespace HttpUtils
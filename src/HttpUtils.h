@@ -0,0 +1,86 @@
+#ifndef HTTP_UTILS_H
+#define HTTP_UTILS_H
+
+#include <Arduino.h>
+#include <time.h>
+
+namespace HttpUtils {
+
+// Files with a modification time before this (2001-09-09) were written with
+// the clock not set: their timestamp is meaningless for HTTP validators
+static constexpr time_t MIN_VALID_TIME = 1000000000;
+
+/*
+  FNV-1a 32 bit hash. constexpr, so PROGMEM arrays declared in headers
+  (e.g. the built-in web pages) get their ETag computed at compile time
+*/
+template <size_t N>
+constexpr uint32_t fnv1a32(const uint8_t (&data)[N]) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < N; ++i) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/*
+  Strong ETag for a content hash: "1a2b3c4d"
+*/
+String makeEtag(uint32_t hash);
+
+/*
+  Weak ETag built from file metadata: W/"size-mtime[-suffix]".
+  When mtime is not valid, generation (bumped on every FS change) is used instead.
+  suffix tells apart encodings of the same resource (e.g. "gz", "br")
+*/
+String makeEtag(size_t size, time_t mtime, uint32_t generation, const char *suffix = nullptr);
+
+/*
+  Format a timestamp as IMF-fixdate (RFC 7231), e.g. "Sun, 06 Nov 1994 08:49:37 GMT"
+*/
+String formatHttpDate(time_t t);
+
+/*
+  Parse an IMF-fixdate string. Returns 0 if the date can't be parsed
+*/
+time_t parseHttpDate(const char *date);
+
+/*
+  True if the If-None-Match header value matches etag (weak comparison, "*" matches any)
+*/
+bool etagMatches(const String &ifNoneMatch, const String &etag);
+
+enum class RangeResult {
+  None,          // No usable Range header: send the whole representation
+  Satisfiable,   // start/length describe the requested slice
+  Unsatisfiable  // Answer 416 Range Not Satisfiable
+};
+
+/*
+  Parse a single "bytes=" range (first-last, first- or -suffix) against a resource of
+  the given size. Multiple ranges and malformed values are ignored (RangeResult::None)
+*/
+RangeResult parseRange(const String &range, size_t size, size_t &start, size_t &length);
+
+/*
+  Evaluate an If-Range header: the range applies only if it carries the current
+  strong ETag or exactly the current Last-Modified date
+*/
+bool ifRangeMatches(const String &ifRange, const String &etag, time_t lastModified);
+
+/*
+  True if the Accept-Encoding header value allows the given content coding
+  (listed, or matched by "*", with a non-zero q-value)
+*/
+bool acceptsEncoding(const String &acceptEncoding, const char *coding);
+
+/*
+  Shell-like match of text with pattern: '*' any sequence of characters, '?' a single one.
+  Used by the Cache-Control rules and by the name filter of /search
+*/
+bool globMatch(const char *pattern, const char *text);
+
+}  // namespace HttpUtils
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef LOCK_FREE_QUEUE_H
+#define LOCK_FREE_QUEUE_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Bounded lock-free queues used to exchange messages between the server task and the
+  application tasks. N must be a power of two, T should be a small trivially copyable type
+  (e.g. a struct with a pointer to heap data owned by the message).
+*/
+
+/*
+  Single producer, single consumer ring buffer
+*/
+template <typename T, size_t N>
+class SpscQueue {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+  bool push(const T &item) {
+    size_t head = m_head.load(std::memory_order_relaxed);
+    if (head - m_tail.load(std::memory_order_acquire) == N) {
+      return false;  // Full
+    }
+    m_items[head & (N - 1)] = item;
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &item) {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail == m_head.load(std::memory_order_acquire)) {
+      return false;  // Empty
+    }
+    item = m_items[tail & (N - 1)];
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool empty() const {
+    return m_tail.load(std::memory_order_acquire) == m_head.load(std::memory_order_acquire);
+  }
+
+private:
+  T m_items[N];
+  std::atomic<size_t> m_head{0};  // Written by the producer only
+  std::atomic<size_t> m_tail{0};  // Written by the consumer only
+};
+
+/*
+  Multiple producers, single consumer queue (D. Vyukov's bounded queue).
+  Each cell has a sequence number telling whether it is free for the producer
+  at position pos (seq == pos) or ready for the consumer (seq == pos + 1)
+*/
+template <typename T, size_t N>
+class MpscQueue {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "MpscQueue size must be a power of two");
+
+public:
+  MpscQueue() {
+    for (size_t i = 0; i < N; ++i) {
+      m_cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  bool push(const T &item) {
+    size_t pos = m_enqueue.load(std::memory_order_relaxed);
+    Cell *cell;
+    while (true) {
+      cell = &m_cells[pos & (N - 1)];
+      size_t seq = cell->seq.load(std::memory_order_acquire);
+      intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+      if (diff == 0) {
+        if (m_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      else if (diff < 0) {
+        return false;  // Full
+      }
+      else {
+        pos = m_enqueue.load(std::memory_order_relaxed);
+      }
+    }
+    cell->data = item;
+    cell->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &item) {
+    Cell *cell = &m_cells[m_dequeue & (N - 1)];
+    size_t seq = cell->seq.load(std::memory_order_acquire);
+    if ((intptr_t)seq - (intptr_t)(m_dequeue + 1) < 0) {
+      return false;  // Empty (or the producer hasn't finished writing yet)
+    }
+    item = cell->data;
+    cell->seq.store(m_dequeue + N, std::memory_order_release);
+    m_dequeue++;
+    return true;
+  }
+
+private:
+  struct Cell {
+    std::atomic<size_t> seq;
+    T data;
+  };
+  Cell m_cells[N];
+  std::atomic<size_t> m_enqueue{0};
+  size_t m_dequeue = 0;  // Consumer only
+};
+
+#endif
@@ -0,0 +1,364 @@
+#include "RetentionManager.h"
+#include "HttpUtils.h"
+#include "SerialLog.h"
+#include <algorithm>
+
+#if defined(ESP32)
+namespace {
+struct RetentionLock {
+    explicit RetentionLock(SemaphoreHandle_t lock) : m_lock(lock) {
+        if (m_lock) {
+            xSemaphoreTakeRecursive(m_lock, portMAX_DELAY);
+        }
+    }
+    ~RetentionLock() {
+        if (m_lock) {
+            xSemaphoreGiveRecursive(m_lock);
+        }
+    }
+    SemaphoreHandle_t m_lock;
+};
+}
+#define RETENTION_LOCK() RetentionLock lock(m_lock)
+#else
+#define RETENTION_LOCK()
+#endif
+
+static String normalizeDir(const String &dir) {
+    String path = dir.startsWith("/") ? dir : "/" + dir;
+    while (path.length() > 1 && path.endsWith("/")) {
+        path.remove(path.length() - 1);
+    }
+    return path;
+}
+
+static inline String folderPrefix(const String &dir) {
+    return dir == "/" ? dir : dir + "/";
+}
+
+// Oldest first: files without a valid time (0) by name, then by time and name
+static bool isOlder(time_t timeA, const String &nameA, time_t timeB, const String &nameB) {
+    if (timeA != timeB) {
+        return timeA < timeB;
+    }
+    return nameA < nameB;
+}
+
+void RetentionManager::begin(fs::FS *fs, FreeSpaceF freeSpace, DeleteCallbackF onDelete) {
+    m_fs = fs;
+    m_freeSpace = freeSpace;
+    m_onDelete = onDelete;
+}
+
+bool RetentionManager::add(const String &dir, const RetentionPolicy &policy) {
+#if defined(ESP32)
+    // Created here and not in begin(), which may run in a global constructor
+    if (!m_lock) {
+        m_lock = xSemaphoreCreateRecursiveMutex();
+    }
+#endif
+    RETENTION_LOCK();
+    String path = normalizeDir(dir);
+    Folder *slot = nullptr;
+    for (Folder &folder : m_folders) {
+        if (folder.dir == path) {
+            slot = &folder;
+            break;
+        }
+        if (folder.dir.isEmpty() && !slot) {
+            slot = &folder;
+        }
+    }
+    if (!slot) {
+        log_error("Retention: no free slot for %s", path.c_str());
+        return false;
+    }
+    slot->policy = policy;
+    if (slot->dir != path) {
+        slot->dir = path;
+        slot->files.clear();
+        slot->bytes = 0;
+        slot->indexed = false;
+    }
+    return true;
+}
+
+void RetentionManager::remove(const String &dir) {
+    RETENTION_LOCK();
+    String path = normalizeDir(dir);
+    for (Folder &folder : m_folders) {
+        if (folder.dir == path) {
+            if (m_indexing == &folder) {
+                m_walker.end();
+                m_indexing = nullptr;
+            }
+            folder.dir = "";
+            folder.files.clear();
+            folder.files.shrink_to_fit();
+            folder.bytes = 0;
+            folder.indexed = false;
+        }
+    }
+}
+
+RetentionManager::Folder *RetentionManager::find(const String &path, String *name) {
+    for (Folder &folder : m_folders) {
+        if (folder.dir.isEmpty()) {
+            continue;
+        }
+        String prefix = folderPrefix(folder.dir);
+        if (path.startsWith(prefix) && path.length() > prefix.length()) {
+            if (name) {
+                *name = path.substring(prefix.length());
+            }
+            return &folder;
+        }
+    }
+    return nullptr;
+}
+
+void RetentionManager::changed(const String &path, FsChangeType type) {
+    if (path.isEmpty() || !m_fs) {
+        return;
+    }
+    RETENTION_LOCK();
+    for (Folder &folder : m_folders) {
+        if (folder.dir.isEmpty()) {
+            continue;
+        }
+        String prefix = folderPrefix(folder.dir);
+        bool parent = path == folder.dir || prefix.startsWith(path.endsWith("/") ? path : path + "/");
+        if (!parent && !path.startsWith(prefix)) {
+            continue;
+        }
+
+        bool reindex = parent || m_indexing == &folder;
+        if (!reindex && folder.indexed) {
+            String name = path.substring(prefix.length());
+            erase(folder, name, true);
+            if (type != FS_CHANGE_DELETED) {
+                File file = m_fs->open(path, "r");
+                if (file && file.isDirectory()) {
+                    // A whole folder written (e.g. an archive extracted): walk again
+                    reindex = true;
+                }
+                else if (file) {
+                    insert(folder, name, file.size(), file.getLastWrite());
+                }
+            }
+        }
+        if (reindex) {
+            if (m_indexing == &folder) {
+                m_walker.end();
+                m_indexing = nullptr;
+            }
+            folder.files.clear();
+            folder.bytes = 0;
+            folder.indexed = false;
+        }
+    }
+}
+
+void RetentionManager::index(Folder &folder, uint32_t budgetMs) {
+    if (m_indexing != &folder) {
+        if (m_indexing) {
+            // Another folder was half done: it starts again later
+            m_indexing->files.clear();
+            m_indexing->bytes = 0;
+        }
+        m_indexing = nullptr;
+        folder.files.clear();
+        folder.bytes = 0;
+        if (!m_walker.begin(*m_fs, folder.dir)) {
+            // No folder (yet): nothing to keep
+            folder.indexed = true;
+            return;
+        }
+        m_indexing = &folder;
+    }
+
+    uint32_t start = millis();
+    File file;
+    String name;
+    DirWalker::Kind kind;
+    while ((kind = m_walker.next(file, name)) != DirWalker::END) {
+        if (kind == DirWalker::FILE_ENTRY) {
+            time_t mtime = file.getLastWrite();
+            folder.files.push_back({name, (uint32_t)file.size(), mtime >= HttpUtils::MIN_VALID_TIME ? mtime : 0});
+            folder.bytes += file.size();
+        }
+        if (millis() - start >= budgetMs) {
+            return;
+        }
+    }
+    std::sort(folder.files.begin(), folder.files.end(), [](const Entry &a, const Entry &b) {
+        return isOlder(a.mtime, a.name, b.mtime, b.name);
+    });
+    folder.indexed = true;
+    m_indexing = nullptr;
+    log_debug("Retention index of %s: %u files, %u bytes", folder.dir.c_str(), (unsigned)folder.files.size(),
+              (unsigned)folder.bytes);
+}
+
+void RetentionManager::insert(Folder &folder, const String &name, uint32_t size, time_t mtime) {
+    mtime = mtime >= HttpUtils::MIN_VALID_TIME ? mtime : 0;
+    auto pos = std::upper_bound(folder.files.begin(), folder.files.end(), Entry{name, size, mtime},
+                                [](const Entry &a, const Entry &b) { return isOlder(a.mtime, a.name, b.mtime, b.name); });
+    folder.files.insert(pos, Entry{name, size, mtime});
+    folder.bytes += size;
+}
+
+bool RetentionManager::erase(Folder &folder, const String &name, bool prefix) {
+    String below = name + "/";
+    bool found = false;
+    for (size_t i = 0; i < folder.files.size();) {
+        const Entry &entry = folder.files[i];
+        if (entry.name == name || (prefix && entry.name.startsWith(below))) {
+            folder.bytes -= entry.size;
+            folder.files.erase(folder.files.begin() + i);
+            found = true;
+            continue;
+        }
+        i++;
+    }
+    return found;
+}
+
+bool RetentionManager::overLimit(Folder &folder, uint64_t extraBytes, bool newFile, bool checkAge) {
+    const RetentionPolicy &policy = folder.policy;
+    if (policy.maxBytes && folder.bytes + extraBytes > policy.maxBytes) {
+        return true;
+    }
+    if (policy.maxFiles && folder.files.size() + (newFile ? 1 : 0) > policy.maxFiles) {
+        return true;
+    }
+    if (checkAge && policy.maxAge) {
+        time_t now = time(nullptr);
+        if (now >= HttpUtils::MIN_VALID_TIME) {
+            for (const Entry &entry : folder.files) {
+                // Files without a valid time can't be aged
+                if (entry.mtime) {
+                    if (now - entry.mtime > (time_t)policy.maxAge) {
+                        return true;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    if (policy.minFree && freeSpace() < policy.minFree + extraBytes) {
+        return true;
+    }
+    return false;
+}
+
+bool RetentionManager::deleteOldest(Folder &folder, const String &keep, bool checkAge) {
+    for (size_t i = 0; i < folder.files.size(); i++) {
+        Entry &entry = folder.files[i];
+        if (entry.name == keep) {
+            continue;
+        }
+        // Over the age limit only: files without a valid time are not the reason
+        if (checkAge && !overLimit(folder, 0, false, false) && !entry.mtime) {
+            continue;
+        }
+        String path = folderPrefix(folder.dir) + entry.name;
+        if (!m_fs->remove(path) && m_fs->exists(path)) {
+            log_error("Retention: can't delete %s", path.c_str());
+            continue;
+        }
+        log_info("Retention: %s deleted", path.c_str());
+        m_free += entry.size;
+        folder.bytes -= entry.size;
+        folder.files.erase(folder.files.begin() + i);
+        if (m_onDelete) {
+            m_onDelete(path);
+        }
+        return true;
+    }
+    return false;
+}
+
+bool RetentionManager::reserve(const String &path, size_t bytes) {
+    RETENTION_LOCK();
+    String name;
+    Folder *folder = find(path, &name);
+    if (!folder) {
+        return freeSpace() >= bytes;
+    }
+    if (!folder->indexed) {
+        index(*folder, UINT32_MAX);
+    }
+
+    auto existing = std::find_if(folder->files.begin(), folder->files.end(),
+                                 [&name](const Entry &entry) { return entry.name == name; });
+    bool newFile = existing == folder->files.end();
+    while (overLimit(*folder, bytes, newFile, false)) {
+        if (!deleteOldest(*folder, name, false)) {
+            log_error("Retention: no room for %u bytes in %s", (unsigned)bytes, path.c_str());
+            return false;
+        }
+    }
+
+    // Account the data now: the file is the newest one
+    uint32_t size = bytes;
+    existing = std::find_if(folder->files.begin(), folder->files.end(),
+                            [&name](const Entry &entry) { return entry.name == name; });
+    if (existing != folder->files.end()) {
+        size += existing->size;
+        erase(*folder, name);
+    }
+    insert(*folder, name, size, time(nullptr));
+    m_free = m_free > bytes ? m_free - bytes : 0;
+    return true;
+}
+
+void RetentionManager::run(uint32_t budgetMs) {
+    if (!m_fs) {
+        return;
+    }
+    RETENTION_LOCK();
+    for (Folder &folder : m_folders) {
+        if (!folder.dir.isEmpty() && !folder.indexed) {
+            index(folder, budgetMs);
+            return;
+        }
+    }
+
+    uint32_t start = millis();
+    for (Folder &folder : m_folders) {
+        if (folder.dir.isEmpty()) {
+            continue;
+        }
+        while (overLimit(folder, 0, false, true)) {
+            if (!deleteOldest(folder, String(), true) || millis() - start >= budgetMs) {
+                break;
+            }
+        }
+    }
+}
+
+bool RetentionManager::usage(const String &dir, uint64_t &bytes, uint32_t &files) {
+    RETENTION_LOCK();
+    String path = normalizeDir(dir);
+    for (Folder &folder : m_folders) {
+        if (!folder.dir.isEmpty() && folder.dir == path) {
+            bytes = folder.bytes;
+            files = folder.files.size();
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t RetentionManager::freeSpace() {
+    if (!m_freeSpace) {
+        return UINT64_MAX;
+    }
+    if (!m_freeKnown || millis() - m_freeCheckedAt >= ESP_FS_WS_RETENTION_FREE_CHECK) {
+        m_free = m_freeSpace();
+        m_freeCheckedAt = millis();
+        m_freeKnown = true;
+    }
+    return m_free;
+}
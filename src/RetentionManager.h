@@ -0,0 +1,125 @@
+#ifndef RETENTION_MANAGER_H
+#define RETENTION_MANAGER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <functional>
+#include <vector>
+#include "DirWalker.h"
+#include "ChangeJournal.h"
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
+
+// Folders with a retention policy
+#ifndef ESP_FS_WS_RETENTION_DIRS
+#define ESP_FS_WS_RETENTION_DIRS 4
+#endif
+
+// Milliseconds of indexing / deleting done in each run() call
+#ifndef ESP_FS_WS_RETENTION_BUDGET
+#define ESP_FS_WS_RETENTION_BUDGET 10
+#endif
+
+// Free space is measured again after this many ms (in between it is estimated from reserve())
+#ifndef ESP_FS_WS_RETENTION_FREE_CHECK
+#define ESP_FS_WS_RETENTION_FREE_CHECK 10000
+#endif
+
+/*
+  Limits of a folder; 0 means no limit
+*/
+struct RetentionPolicy {
+  uint64_t maxBytes = 0;      // Total size of the files in the folder
+  uint32_t maxFiles = 0;      // Number of files in the folder
+  uint32_t maxAge = 0;        // Seconds since the last write of a file (needs the clock set)
+  uint64_t minFree = 0;       // Free space to keep on the filesystem
+};
+
+/*
+  Keeps append-only data folders (daily logs, CSV files) within a policy by deleting their
+  oldest files. Every folder has an index of its files (subfolders included) sorted oldest
+  first: by last write time, then by name for files without a valid time, so names like
+  2024_05_01.csv work without a clock. The index is built once by a background walk and then
+  kept up to date with changed(), without walking the folder again.
+  Deletions happen a few at a time in run(), and synchronously in reserve() before an append.
+*/
+class RetentionManager {
+public:
+  using FreeSpaceF = std::function<uint64_t()>;           // Free bytes on the filesystem
+  using DeleteCallbackF = std::function<void(const String &path)>;
+
+  /*
+    fs must outlive the manager. freeSpace is needed for RetentionPolicy::minFree,
+    onDelete is called for every file deleted
+  */
+  void begin(fs::FS *fs, FreeSpaceF freeSpace = nullptr, DeleteCallbackF onDelete = nullptr);
+
+  /*
+    Apply policy to dir (replacing the previous one). Returns false if all the slots are used
+  */
+  bool add(const String &dir, const RetentionPolicy &policy);
+  void remove(const String &dir);
+
+  /*
+    Update the index after a change of path (file or folder, "" is ignored)
+  */
+  void changed(const String &path, FsChangeType type);
+
+  /*
+    Make room for bytes about to be appended to path: deletes the oldest files of its folder
+    (never path itself) until the policy, and the free space, allow it. The index is updated
+    as if the data were written. Returns false if there is no way to fit them
+  */
+  bool reserve(const String &path, size_t bytes);
+
+  /*
+    Background work: index the new folders, then delete what is beyond the limits
+  */
+  void run(uint32_t budgetMs);
+
+  /*
+    Size and number of files of a folder, as indexed (false if dir has no policy)
+  */
+  bool usage(const String &dir, uint64_t &bytes, uint32_t &files);
+
+private:
+  struct Entry {
+    String name;            // Relative to the folder
+    uint32_t size;
+    time_t mtime;           // 0 if not valid
+  };
+
+  struct Folder {
+    String dir;             // "" = free slot
+    RetentionPolicy policy;
+    std::vector<Entry> files;
+    uint64_t bytes = 0;
+    bool indexed = false;
+  };
+
+  Folder *find(const String &path, String *name = nullptr);
+  void index(Folder &folder, uint32_t budgetMs);
+  void insert(Folder &folder, const String &name, uint32_t size, time_t mtime);
+  bool erase(Folder &folder, const String &name, bool prefix = false);
+  bool overLimit(Folder &folder, uint64_t extraBytes, bool newFile, bool checkAge);
+  bool deleteOldest(Folder &folder, const String &keep, bool checkAge);
+  uint64_t freeSpace();
+
+  fs::FS *m_fs = nullptr;
+  FreeSpaceF m_freeSpace = nullptr;
+  DeleteCallbackF m_onDelete = nullptr;
+  Folder m_folders[ESP_FS_WS_RETENTION_DIRS];
+  DirWalker m_walker;
+  Folder *m_indexing = nullptr;     // Folder m_walker is indexing
+  uint64_t m_free = 0;              // Last measured free space, minus the bytes reserved since
+  uint32_t m_freeCheckedAt = 0;
+  bool m_freeKnown = false;
+#if defined(ESP32)
+  // reserve() is called by the application, run() maybe by the server task
+  SemaphoreHandle_t m_lock = nullptr;
+#endif
+};
+
+#endif
@@ -0,0 +1,24 @@
+#include "RomFs.h"
+
+bool RomFs::find(const char *path, RomFsEntry &entry) const {
+    if (!m_image || !path) {
+        return false;
+    }
+    int32_t low = 0;
+    int32_t high = (int32_t)m_image->count - 1;
+    while (low <= high) {
+        int32_t mid = (low + high) / 2;
+        // The index lives in flash: on ESP8266 it must be copied word by word
+        memcpy_P(&entry, &m_image->entries[mid], sizeof(RomFsEntry));
+        int cmp = strcmp_P(path, entry.path);
+        if (cmp == 0) {
+            return true;
+        }
+        if (cmp < 0) {
+            high = mid - 1;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,61 @@
+#ifndef ROMFS_H
+#define ROMFS_H
+
+#include <Arduino.h>
+#include <pgmspace.h>
+
+/*
+  Read-only file image stored in flash (PROGMEM), generated at build time from a
+  "data" folder with tools/romfs.py:
+
+    python tools/romfs.py data -o romfs_data.h
+
+  The generated header defines a RomFsImage (default name "romfs_data") that can be
+  mounted with FSWebServer::mountRomFs(romfs_data). Files are served straight from
+  flash, without opening anything on the filesystem.
+*/
+
+enum RomFsEncoding : uint8_t {
+  ROMFS_IDENTITY = 0,
+  ROMFS_GZIP = 1
+};
+
+// Index record, one for each file. Entries are sorted by path (byte order)
+struct RomFsEntry {
+  const char *path;     // PROGMEM string, e.g. "/index.htm"
+  const char *mime;     // PROGMEM string, e.g. "text/html"
+  uint32_t offset;      // Offset of file data in RomFsImage::data
+  uint32_t length;      // Stored length (compressed length if encoding != ROMFS_IDENTITY)
+  uint32_t hash;        // FNV-1a 32 of stored bytes, used as ETag
+  uint8_t encoding;     // RomFsEncoding
+};
+
+struct RomFsImage {
+  const uint8_t *data;         // PROGMEM blob with every file
+  const RomFsEntry *entries;   // PROGMEM index
+  uint16_t count;
+};
+
+class RomFs {
+public:
+  RomFs() = default;
+  explicit RomFs(const RomFsImage *image) : m_image(image) {}
+
+  inline bool mounted() const { return m_image != nullptr; }
+
+  /*
+    Look up path in the image index (binary search) and copy its record to entry.
+    Returns false if the file is not in the image
+  */
+  bool find(const char *path, RomFsEntry &entry) const;
+
+  /*
+    Pointer to the first stored byte of entry (flash address)
+  */
+  inline const uint8_t *data(const RomFsEntry &entry) const { return m_image->data + entry.offset; }
+
+private:
+  const RomFsImage *m_image = nullptr;
+};
+
+#endif
@@ -264,6 +264,14 @@ class SetupConfigurator
                 m_doc->setArray("_assets", "js", jsList.empty() ? empty : jsList);
                 m_doc->setArray("_assets", "html", htmlList.empty() ? empty : htmlList);
 
+                // Cache-Control rules are edited by hand: carry them over unchanged
+                if (m_savedDoc && m_savedDoc->getRoot()) {
+                    const cJSON* cache = cJSON_GetObjectItemCaseSensitive(m_savedDoc->getRoot(), "_cache");
+                    if (cache && cJSON_IsObject(cache)) {
+                        cJSON_AddItemToObject(m_doc->getRoot(), "_cache", cJSON_Duplicate(cache, true));
+                    }
+                }
+
                 // Initialize sections builder (will be attached to m_doc on close)
                 m_sectionsArray.createArray();
                 m_currentSection.createObject();
@@ -0,0 +1,448 @@
+#include "TarExtractor.h"
+#include "Crc32.h"
+#include "SerialLog.h"
+
+#if ESP_FS_WS_EXTRACT_GZIP
+#if CONFIG_IDF_TARGET_ESP32
+#include "esp32/rom/miniz.h"
+#elif CONFIG_IDF_TARGET_ESP32S2
+#include "esp32s2/rom/miniz.h"
+#elif CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/miniz.h"
+#elif CONFIG_IDF_TARGET_ESP32C3
+#include "esp32c3/rom/miniz.h"
+#endif
+#endif
+
+static uint32_t parseOctal(const uint8_t *field, size_t length) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < length && field[i]; i++) {
+        if (field[i] >= '0' && field[i] <= '7') {
+            value = (value << 3) | (field[i] - '0');
+        }
+        else if (field[i] != ' ') {
+            break;
+        }
+    }
+    return value;
+}
+
+TarExtractor::TarExtractor(fs::FS &fs, const String &dir, ExtractCallbackF callback)
+    : m_fs(fs), m_callback(callback) {
+    m_dir = dir.endsWith("/") ? dir.substring(0, dir.length() - 1) : dir;
+    m_lastDir = "/";
+}
+
+TarExtractor::~TarExtractor() {
+    closeFile(false);
+#if ESP_FS_WS_EXTRACT_GZIP
+    free(m_inflator);
+    free(m_dict);
+#endif
+}
+
+void TarExtractor::fail(const char *error) {
+    if (m_state != FAILED) {
+        log_error("Extract: %s", error);
+        m_error = error;
+        m_state = FAILED;
+        closeFile(false);
+    }
+}
+
+bool TarExtractor::write(const uint8_t *data, size_t length) {
+    if (m_state == FAILED) {
+        return false;
+    }
+    if (!m_started && length) {
+        // A tar archive starts with a name, never with the gzip magic number
+        m_started = true;
+        if (data[0] == 0x1f) {
+#if ESP_FS_WS_EXTRACT_GZIP
+            m_gzip = GZ_HEADER;
+#else
+            fail("GZIP NOT SUPPORTED");
+            return false;
+#endif
+        }
+    }
+#if ESP_FS_WS_EXTRACT_GZIP
+    if (m_gzip != GZ_NONE) {
+        return gunzip(data, length);
+    }
+#endif
+    consume(data, length);
+    return m_state != FAILED;
+}
+
+void TarExtractor::consume(const uint8_t *data, size_t length) {
+    while (length && m_state != FAILED && m_state != DONE) {
+        size_t n;
+        switch (m_state) {
+        case HEADER:
+            n = sizeof(m_header) - m_fill;
+            n = n < length ? n : length;
+            memcpy(m_header + m_fill, data, n);
+            m_fill += n;
+            if (m_fill == sizeof(m_header)) {
+                m_fill = 0;
+                parseHeader();
+            }
+            break;
+
+        case DATA:
+        case META:
+        case SKIP:
+            n = m_remaining < length ? m_remaining : length;
+            if (m_state == DATA) {
+                if (m_writer.write(data, n) != n) {
+                    fail("WRITE FAILED");
+                    return;
+                }
+                m_bytes += n;
+            }
+            else if (m_state == META && m_meta.length() < 1024) {
+                for (size_t i = 0; i < n; i++) {
+                    m_meta += (char)data[i];
+                }
+            }
+            m_remaining -= n;
+            if (m_remaining == 0) {
+                if (m_state == DATA) {
+                    closeFile(true);
+                    if (m_state == FAILED) {
+                        return;
+                    }
+                }
+                else if (m_state == META) {
+                    if (m_metaType == 'L') {
+                        // GNU long name: NUL terminated name of the next entry
+                        m_longName = m_meta.c_str();
+                    }
+                    else {
+                        // pax records: "<length> <key>=<value>\n"
+                        int pos = m_meta.indexOf(" path=");
+                        if (pos >= 0) {
+                            int stop = m_meta.indexOf('\n', pos);
+                            m_longName = m_meta.substring(pos + 6, stop < 0 ? m_meta.length() : stop);
+                        }
+                    }
+                    m_meta = "";
+                }
+                m_state = m_padding ? PADDING : HEADER;
+            }
+            break;
+
+        case PADDING:
+            n = m_padding < length ? m_padding : length;
+            m_padding -= n;
+            if (m_padding == 0) {
+                m_state = HEADER;
+            }
+            break;
+
+        default:
+            return;
+        }
+        data += n;
+        length -= n;
+    }
+}
+
+void TarExtractor::parseHeader() {
+    bool empty = true;
+    for (uint8_t c : m_header) {
+        if (c) {
+            empty = false;
+            break;
+        }
+    }
+    if (empty) {
+        // Two empty blocks end the archive
+        if (++m_zeroBlocks == 2) {
+            m_state = DONE;
+        }
+        return;
+    }
+    m_zeroBlocks = 0;
+
+    uint32_t sum = 0;
+    for (size_t i = 0; i < sizeof(m_header); i++) {
+        sum += (i >= 148 && i < 156) ? ' ' : m_header[i];
+    }
+    if (sum != parseOctal(m_header + 148, 8)) {
+        fail("BAD ARCHIVE");
+        return;
+    }
+
+    uint32_t size = parseOctal(m_header + 124, 12);
+    char type = m_header[156];
+    m_remaining = size;
+    m_padding = (512 - size % 512) % 512;
+
+    if (type == 'L' || type == 'x') {
+        m_state = size ? META : HEADER;
+        m_metaType = type;
+        m_meta = "";
+        return;
+    }
+
+    String name;
+    if (m_longName.length()) {
+        name = m_longName;
+        m_longName = "";
+    }
+    else {
+        if (memcmp(m_header + 257, "ustar", 5) == 0 && m_header[345]) {
+            name.concat((const char *)m_header + 345, strnlen((const char *)m_header + 345, 155));
+            name += '/';
+        }
+        name.concat((const char *)m_header, strnlen((const char *)m_header, 100));
+    }
+
+    String path;
+    m_state = SKIP;
+    if (!entryPath(name, path)) {
+        log_debug("Extract: %s skipped", name.c_str());
+    }
+    else if (type == '5') {
+        if (!ensureDir(path)) {
+            fail("MKDIR FAILED");
+            return;
+        }
+        m_dirs++;
+    }
+    else if (type == '0' || type == '\0' || type == '7') {
+        if (!ensureDir(path.substring(0, path.lastIndexOf('/')))) {
+            fail("MKDIR FAILED");
+            return;
+        }
+        m_file = m_fs.open(path, "w");
+        if (!m_file) {
+            fail("CREATE FAILED");
+            return;
+        }
+        m_writer.begin(m_file);
+        m_path = path;
+        m_size = size;
+        m_state = DATA;
+        if (size == 0) {
+            closeFile(true);
+        }
+    }
+    if (m_remaining == 0 && m_state != FAILED) {
+        m_state = m_padding ? PADDING : HEADER;
+    }
+}
+
+void TarExtractor::closeFile(bool complete) {
+    if (!m_file) {
+        return;
+    }
+    bool flushed = m_writer.end();
+    m_file.close();
+    if (!complete || !flushed) {
+        // Truncated: don't leave half a file behind
+        m_fs.remove(m_path);
+        if (complete) {
+            fail("WRITE FAILED");
+        }
+        return;
+    }
+    m_files++;
+    log_debug("Extract: %s (%u bytes)", m_path.c_str(), m_size);
+    if (m_callback) {
+        m_callback(m_path.c_str(), m_size);
+    }
+}
+
+bool TarExtractor::entryPath(String name, String &path) {
+    while (name.startsWith("./")) {
+        name.remove(0, 2);
+    }
+    while (name.startsWith("/")) {
+        name.remove(0, 1);
+    }
+    while (name.endsWith("/")) {
+        name.remove(name.length() - 1);
+    }
+    if (name.isEmpty() || name == "." || name.length() > ESP_FS_WS_EXTRACT_MAX_NAME) {
+        return false;
+    }
+    // No way out of the target folder
+    String check = "/" + name + "/";
+    if (check.indexOf("/../") >= 0) {
+        return false;
+    }
+    path = m_dir + "/" + name;
+    return true;
+}
+
+bool TarExtractor::ensureDir(const String &dir) {
+    if (dir.isEmpty() || dir == m_lastDir || m_lastDir.startsWith(dir + "/")) {
+        return true;
+    }
+    // Create the missing levels, from the top
+    int pos = 0;
+    while (pos >= 0) {
+        pos = dir.indexOf('/', pos + 1);
+        String level = pos < 0 ? dir : dir.substring(0, pos);
+        if (!m_fs.exists(level) && !m_fs.mkdir(level)) {
+            return false;
+        }
+    }
+    m_lastDir = dir;
+    return true;
+}
+
+bool TarExtractor::end() {
+#if ESP_FS_WS_EXTRACT_GZIP
+    if (m_gzip != GZ_NONE && m_gzip != GZ_DONE && m_state != FAILED) {
+        fail("TRUNCATED");
+    }
+#endif
+    if (m_state == DATA || m_state == META || (m_state == SKIP && m_remaining) || m_fill) {
+        fail("TRUNCATED");
+    }
+    // Some writers omit the end blocks: fine if the last entry is complete
+    return m_state != FAILED;
+}
+
+#if ESP_FS_WS_EXTRACT_GZIP
+bool TarExtractor::gunzip(const uint8_t *data, size_t length) {
+    while (length && m_state != FAILED) {
+        uint8_t c;
+        switch (m_gzip) {
+        case GZ_HEADER:
+            m_gzBuf[m_gzFill++] = *data++;
+            length--;
+            if (m_gzFill == 10) {
+                if (m_gzBuf[0] != 0x1f || m_gzBuf[1] != 0x8b || m_gzBuf[2] != 8) {
+                    fail("BAD GZIP");
+                    return false;
+                }
+                m_gzFlags = m_gzBuf[3];
+                m_gzFill = 0;
+                m_gzip = GZ_EXTRA_LEN;
+            }
+            break;
+
+        // Optional header fields, in this order
+        case GZ_EXTRA_LEN:
+            if (!(m_gzFlags & 0x04)) {
+                m_gzip = GZ_NAME;
+                break;
+            }
+            m_gzBuf[m_gzFill++] = *data++;
+            length--;
+            if (m_gzFill == 2) {
+                m_gzSkip = m_gzBuf[0] | (m_gzBuf[1] << 8);
+                m_gzFill = 0;
+                m_gzip = GZ_EXTRA;
+            }
+            break;
+        case GZ_EXTRA:
+            if (m_gzSkip) {
+                size_t n = m_gzSkip < length ? m_gzSkip : length;
+                m_gzSkip -= n;
+                data += n;
+                length -= n;
+            }
+            if (!m_gzSkip) {
+                m_gzip = GZ_NAME;
+            }
+            break;
+        case GZ_NAME:
+        case GZ_COMMENT:
+            if (!(m_gzFlags & (m_gzip == GZ_NAME ? 0x08 : 0x10))) {
+                m_gzip = m_gzip == GZ_NAME ? GZ_COMMENT : GZ_HCRC;
+                break;
+            }
+            c = *data++;
+            length--;
+            if (c == 0) {
+                m_gzFlags &= m_gzip == GZ_NAME ? ~0x08 : ~0x10;
+            }
+            break;
+        case GZ_HCRC:
+            if (m_gzFlags & 0x02) {
+                data++;
+                length--;
+                if (++m_gzFill < 2) {
+                    break;
+                }
+                m_gzFill = 0;
+            }
+            m_inflator = (tinfl_decompressor *)malloc(sizeof(tinfl_decompressor));
+            m_dict = (uint8_t *)malloc(TINFL_LZ_DICT_SIZE);
+            if (!m_inflator || !m_dict) {
+                fail("OUT OF MEMORY");
+                return false;
+            }
+            tinfl_init(m_inflator);
+            m_gzip = GZ_DATA;
+            break;
+
+        case GZ_DATA:
+            if (!inflate(data, length)) {
+                return false;
+            }
+            break;
+
+        case GZ_TRAILER:
+            m_gzBuf[m_gzFill++] = *data++;
+            length--;
+            if (m_gzFill == 8) {
+                uint32_t crc = m_gzBuf[0] | (m_gzBuf[1] << 8) | (m_gzBuf[2] << 16) | ((uint32_t)m_gzBuf[3] << 24);
+                uint32_t size = m_gzBuf[4] | (m_gzBuf[5] << 8) | (m_gzBuf[6] << 16) | ((uint32_t)m_gzBuf[7] << 24);
+                if (crc != m_gzCrc || size != m_gzSize) {
+                    fail("BAD GZIP");
+                    return false;
+                }
+                m_gzip = GZ_DONE;
+            }
+            break;
+
+        default:
+            // Trailing data after the gzip member is ignored
+            return true;
+        }
+    }
+    return m_state != FAILED;
+}
+
+bool TarExtractor::inflate(const uint8_t *&data, size_t &length) {
+    while (true) {
+        size_t in = length;
+        size_t out = TINFL_LZ_DICT_SIZE - m_dictOffset;
+        tinfl_status status = tinfl_decompress(m_inflator, data, &in, m_dict, m_dict + m_dictOffset, &out,
+                                               TINFL_FLAG_HAS_MORE_INPUT);
+        data += in;
+        length -= in;
+        if (out) {
+            m_gzCrc = Crc32::update(m_gzCrc, m_dict + m_dictOffset, out);
+            m_gzSize += out;
+            consume(m_dict + m_dictOffset, out);
+            // The window wraps around: the dictionary must stay where it is
+            m_dictOffset = (m_dictOffset + out) & (TINFL_LZ_DICT_SIZE - 1);
+        }
+        if (status < TINFL_STATUS_DONE) {
+            fail("BAD GZIP");
+            return false;
+        }
+        if (status == TINFL_STATUS_DONE) {
+            free(m_inflator);
+            free(m_dict);
+            m_inflator = nullptr;
+            m_dict = nullptr;
+            m_gzFill = 0;
+            m_gzip = GZ_TRAILER;
+            return true;
+        }
+        if (status == TINFL_STATUS_NEEDS_MORE_INPUT && length == 0) {
+            return true;
+        }
+        yield();
+    }
+}
+#endif
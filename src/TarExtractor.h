@@ -0,0 +1,118 @@
+#ifndef TAR_EXTRACTOR_H
+#define TAR_EXTRACTOR_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <functional>
+#include "BlockWriter.h"
+
+// Accept gzip compressed archives (inflater from the ESP32 ROM, needs about 43 KB of heap while extracting)
+#ifndef ESP_FS_WS_EXTRACT_GZIP
+#if defined(ESP32) && (CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32S3 || CONFIG_IDF_TARGET_ESP32C3)
+#define ESP_FS_WS_EXTRACT_GZIP 1
+#else
+#define ESP_FS_WS_EXTRACT_GZIP 0
+#endif
+#endif
+
+// Longest entry name accepted from GNU long name or pax records
+#ifndef ESP_FS_WS_EXTRACT_MAX_NAME
+#define ESP_FS_WS_EXTRACT_MAX_NAME 255
+#endif
+
+// Called after every extracted file with its full path and size
+using ExtractCallbackF = std::function<void(const char *path, size_t size)>;
+
+#if ESP_FS_WS_EXTRACT_GZIP
+struct tinfl_decompressor_tag;
+#endif
+
+/*
+  Streaming tar extractor: the archive is parsed as it arrives, in pieces of any size,
+  and entries are written below a target folder without buffering whole files.
+  Understands ustar, GNU long names and pax path records; links and devices are skipped.
+  Names with ".." components are rejected. Folders are created once, file data goes
+  through a BlockWriter. A gzip stream (detected from its magic bytes) is inflated on
+  the fly when ESP_FS_WS_EXTRACT_GZIP is enabled.
+*/
+class TarExtractor {
+public:
+  TarExtractor(fs::FS &fs, const String &dir, ExtractCallbackF callback = nullptr);
+  ~TarExtractor();
+
+  TarExtractor(const TarExtractor &) = delete;
+  TarExtractor &operator=(const TarExtractor &) = delete;
+
+  /*
+    Feed the next piece of the archive. Returns false once an error occurred
+    (the rest of the stream is ignored)
+  */
+  bool write(const uint8_t *data, size_t length);
+
+  /*
+    End of the stream. Returns false if the archive was truncated or had errors;
+    a partially written file is removed
+  */
+  bool end();
+
+  inline const char *error() const { return m_error; }
+  inline const String &dir() const { return m_dir; }
+  inline size_t files() const { return m_files; }
+  inline size_t dirs() const { return m_dirs; }
+  inline size_t bytes() const { return m_bytes; }
+
+private:
+  enum State : uint8_t { HEADER, DATA, META, SKIP, PADDING, DONE, FAILED };
+
+  fs::FS &m_fs;
+  String m_dir;                 // Target folder, without trailing '/'
+  ExtractCallbackF m_callback;
+  State m_state = HEADER;
+  bool m_started = false;
+  const char *m_error = nullptr;
+
+  uint8_t m_header[512];
+  size_t m_fill = 0;
+  uint32_t m_remaining = 0;     // Bytes left in the current entry
+  uint32_t m_padding = 0;       // Bytes to the next 512 byte boundary
+  uint8_t m_zeroBlocks = 0;
+  char m_metaType = 0;
+  String m_meta;                // Content of a GNU long name or pax header
+  String m_longName;            // Name for the next entry
+  String m_lastDir;             // Last folder known to exist
+
+  String m_path;                // File being written
+  uint32_t m_size = 0;
+  File m_file;
+  BlockWriter m_writer;
+
+  size_t m_files = 0;
+  size_t m_dirs = 0;
+  size_t m_bytes = 0;
+
+#if ESP_FS_WS_EXTRACT_GZIP
+  enum GzipState : uint8_t { GZ_NONE, GZ_HEADER, GZ_EXTRA_LEN, GZ_EXTRA, GZ_NAME, GZ_COMMENT, GZ_HCRC, GZ_DATA, GZ_TRAILER, GZ_DONE };
+  GzipState m_gzip = GZ_NONE;
+  uint8_t m_gzFlags = 0;
+  uint8_t m_gzBuf[10];
+  size_t m_gzFill = 0;
+  size_t m_gzSkip = 0;
+  uint32_t m_gzCrc = 0;
+  uint32_t m_gzSize = 0;
+  tinfl_decompressor_tag *m_inflator = nullptr;
+  uint8_t *m_dict = nullptr;
+  size_t m_dictOffset = 0;
+
+  bool gunzip(const uint8_t *data, size_t length);
+  bool inflate(const uint8_t *&data, size_t &length);
+#endif
+
+  void consume(const uint8_t *data, size_t length);
+  void parseHeader();
+  void closeFile(bool complete);
+  bool ensureDir(const String &dir);
+  bool entryPath(String name, String &path);
+  void fail(const char *error);
+};
+
+#endif
@@ -0,0 +1,93 @@
+#include "UploadContext.h"
+#include "SerialLog.h"
+
+UploadContext *UploadContextPool::find(const IPAddress &ip, uint16_t port) {
+    for (UploadContext &ctx : m_contexts) {
+        if (ctx.port == port && ctx.ip == ip) {
+            return &ctx;
+        }
+    }
+    return nullptr;
+}
+
+UploadContext &UploadContextPool::acquire(fs::FS *fs, const IPAddress &ip, uint16_t port) {
+    UploadContext *ctx = find(ip, port);
+    if (ctx) {
+        ctx->lastUsed = millis();
+        return *ctx;
+    }
+
+    UploadContext *oldest = &m_contexts[0];
+    for (UploadContext &slot : m_contexts) {
+        if (!slot.port) {
+            ctx = &slot;
+            break;
+        }
+        if (slot.lastUsed < oldest->lastUsed) {
+            oldest = &slot;
+        }
+    }
+    if (!ctx) {
+        log_debug("Upload of %s abandoned", oldest->path.c_str());
+        abort(fs, *oldest);
+        ctx = oldest;
+    }
+
+    ctx->ip = ip;
+    ctx->port = port;
+    ctx->lastUsed = millis();
+    ctx->errorCode = 0;
+    ctx->error = nullptr;
+    return *ctx;
+}
+
+bool UploadContextPool::closeFile(UploadContext &ctx) {
+    bool ok = ctx.writer.end();
+    if (ctx.file) {
+        ctx.file.close();
+    }
+    return ok;
+}
+
+void UploadContextPool::abort(fs::FS *fs, UploadContext &ctx) {
+    if (ctx.file) {
+        closeFile(ctx);
+        // Don't leave a truncated file behind
+        fs->remove(ctx.path);
+    }
+    release(ctx);
+}
+
+void UploadContextPool::release(UploadContext &ctx) {
+    closeFile(ctx);
+    ctx.port = 0;
+    ctx.path = "";
+    ctx.target = "";
+    ctx.received = 0;
+    ctx.expected = 0;
+    ctx.done = 0;
+}
+
+void UploadContextPool::setBuffer(size_t size, bool psram) {
+    for (UploadContext &ctx : m_contexts) {
+        ctx.writer.setBuffer(size, psram);
+    }
+}
+
+size_t UploadContextPool::active() const {
+    size_t count = 0;
+    for (const UploadContext &ctx : m_contexts) {
+        count += ctx.port ? 1 : 0;
+    }
+    return count;
+}
+
+size_t UploadContextPool::pending(const UploadContext *except) const {
+    size_t bytes = 0;
+    for (const UploadContext &ctx : m_contexts) {
+        if (&ctx != except && ctx.port && !ctx.path.isEmpty() && ctx.expected > ctx.done + ctx.received) {
+            bytes += ctx.expected - ctx.done - ctx.received;
+        }
+    }
+    return bytes;
+}
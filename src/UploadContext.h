@@ -0,0 +1,86 @@
+#ifndef UPLOAD_CONTEXT_H
+#define UPLOAD_CONTEXT_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <IPAddress.h>
+#include "BlockWriter.h"
+
+// Uploads (POST /edit) tracked at the same time, one per client connection
+#ifndef ESP_FS_WS_UPLOAD_CONTEXTS
+#define ESP_FS_WS_UPLOAD_CONTEXTS 4
+#endif
+
+// Free space left aside by uploads for the filesystem metadata (an upload that would eat into it gets 507)
+#ifndef ESP_FS_WS_UPLOAD_MIN_FREE
+#define ESP_FS_WS_UPLOAD_MIN_FREE 8192
+#endif
+
+/*
+  State of a multipart upload for one client connection. The write buffer is allocated
+  when a file starts and released when it ends, so idle contexts only cost a few bytes
+*/
+struct UploadContext {
+  IPAddress ip;
+  uint16_t port = 0;          // 0 = free slot
+  String path;                // File being written
+  String target;              // Final path when path is a temporary file renamed at the end ("" = none)
+  File file;
+  BlockWriter writer;
+  size_t received = 0;        // Bytes of the current file
+  size_t expected = 0;        // Content-Length of the request (all parts)
+  size_t done = 0;            // Bytes of the files of this request already written
+  uint32_t started = 0;       // millis() at the start of the current file
+  uint32_t lastUsed = 0;
+  int errorCode = 0;          // First error of the request, sent once the body is consumed
+  const char *error = nullptr;
+
+  inline void fail(int code, const char *message) {
+    if (!errorCode) {
+      errorCode = code;
+      error = message;
+    }
+  }
+};
+
+class UploadContextPool {
+public:
+  /*
+    Context of the connection ip:port, a free one or (all busy) the least recently used,
+    whose upload is abandoned: with a synchronous server only a dropped connection
+    leaves a context behind
+  */
+  UploadContext &acquire(fs::FS *fs, const IPAddress &ip, uint16_t port);
+
+  UploadContext *find(const IPAddress &ip, uint16_t port);
+
+  /*
+    Flush and close the current file. Returns false if the last block could not be written
+  */
+  bool closeFile(UploadContext &ctx);
+
+  /*
+    Close and delete the file of an interrupted upload, then free the slot
+  */
+  void abort(fs::FS *fs, UploadContext &ctx);
+
+  void release(UploadContext &ctx);
+
+  /*
+    Write buffer size and allocation for the files started from now on
+  */
+  void setBuffer(size_t size, bool psram);
+
+  size_t active() const;
+
+  /*
+    Bytes still to come for the files being written by the other connections (as declared
+    by their Content-Length), to be left free by a new upload
+  */
+  size_t pending(const UploadContext *except) const;
+
+private:
+  UploadContext m_contexts[ESP_FS_WS_UPLOAD_CONTEXTS];
+};
+
+#endif
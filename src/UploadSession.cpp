@@ -0,0 +1,244 @@
+#include "UploadSession.h"
+#include "Crc32.h"
+#include "SerialLog.h"
+
+#if ESP_FS_WS_UPLOAD_SESSIONS
+
+UploadSession *UploadSessionTable::find(uint32_t id) {
+    if (id == 0) {
+        return nullptr;
+    }
+    for (UploadSession &session : m_sessions) {
+        if (session.id == id) {
+            return &session;
+        }
+    }
+    return nullptr;
+}
+
+UploadSession *UploadSessionTable::start(const String &path, uint32_t size, uint32_t hash, bool hasHash, Result &result) {
+    UploadSession *slot = nullptr;
+    UploadSession *idle = nullptr;
+    uint32_t now = millis();
+    for (UploadSession &session : m_sessions) {
+        if (session.id && session.path == path) {
+            if (session.size == size && session.hasHash == hasHash && session.hash == hash) {
+                // Same upload: the client lost track of it
+                session.lastUsed = now;
+                result = OK;
+                return &session;
+            }
+            // Same path, different content: start over
+            abort(session.id);
+        }
+        if (!session.id) {
+            slot = slot ? slot : &session;
+        }
+        else if (now - session.lastUsed > ESP_FS_WS_UPLOAD_SESSION_TIMEOUT) {
+            idle = (!idle || session.lastUsed < idle->lastUsed) ? &session : idle;
+        }
+    }
+    if (!slot && idle) {
+        log_debug("Upload session %08x evicted", idle->id);
+        close(*idle);
+        slot = idle;
+    }
+    if (!slot) {
+        result = NO_SLOT;
+        return nullptr;
+    }
+
+    uint32_t id;
+    do {
+        id = (uint32_t)random(1, 0x7FFFFFFF);
+    } while (find(id));
+
+    slot->path = path;
+    slot->size = size;
+    slot->hash = hash;
+    slot->hasHash = hasHash;
+    slot->lastUsed = now;
+    if (!resumePart(*slot)) {
+        log_error("Can't create %s", slot->partPath().c_str());
+        close(*slot);
+        result = FS_ERROR;
+        return nullptr;
+    }
+    slot->id = id;
+    log_debug("Upload session %08x: %s, %u bytes, resumed at %u", id, path.c_str(), size, slot->offset);
+    result = OK;
+    return slot;
+}
+
+bool UploadSessionTable::resumePart(UploadSession &session) {
+    String part = session.partPath();
+    session.offset = 0;
+    session.crc = 0;
+
+    // The acknowledged offset, not the file length: chunks rejected by their CRC or cut off
+    // by a dropped connection leave unverified data after it
+    uint32_t ack[2] = {0, 0};
+    File file = m_fs->open(session.ackPath(), "r");
+    bool hasAck = file && file.read((uint8_t *)ack, sizeof(ack)) == sizeof(ack);
+    file.close();
+    if (hasAck && ack[0] <= session.size) {
+        file = m_fs->open(part, "r");
+        if (file && file.size() >= ack[0]) {
+            // Checksum the acknowledged data again: the file may have changed since
+            uint8_t buf[512];
+            uint32_t crc = 0;
+            uint32_t left = ack[0];
+            size_t n;
+            while (left && (n = file.read(buf, left < sizeof(buf) ? left : sizeof(buf))) > 0) {
+                crc = Crc32::update(crc, buf, n);
+                left -= n;
+                yield();
+            }
+            if (!left && crc == ack[1]) {
+                session.offset = ack[0];
+                session.crc = crc;
+            }
+        }
+        file.close();
+    }
+    if (!session.offset) {
+        // Nothing trusted: start from scratch
+        removePart(session.path);
+    }
+
+    // "r+" allows the data after the acknowledged offset to be overwritten
+    session.file = m_fs->open(part, session.offset ? "r+" : "w");
+    return session.file && session.file.seek(session.offset);
+}
+
+bool UploadSessionTable::saveAck(const UploadSession &session) {
+    uint32_t ack[2] = {session.offset, session.crc};
+    File file = m_fs->open(session.ackPath(), "w");
+    bool ok = file && file.write((const uint8_t *)ack, sizeof(ack)) == sizeof(ack);
+    file.close();
+    return ok;
+}
+
+void UploadSessionTable::removePart(const String &path) {
+    m_fs->remove(path + ESP_FS_WS_UPLOAD_PART_EXT);
+    m_fs->remove(path + ESP_FS_WS_UPLOAD_PART_EXT ".ack");
+}
+
+UploadSessionTable::Result UploadSessionTable::beginChunk(uint32_t id, uint32_t offset, uint32_t crc) {
+    m_chunk = find(id);
+    if (!m_chunk) {
+        m_chunkResult = NOT_FOUND;
+        return m_chunkResult;
+    }
+    m_chunkExpected = crc;
+    m_chunkCrc = 0;
+    m_chunkRunning = m_chunk->crc;
+    m_chunkLength = 0;
+    m_chunkResult = OK;
+    m_chunk->lastUsed = millis();
+    if (offset != m_chunk->offset) {
+        m_chunkResult = BAD_OFFSET;
+    }
+    else if (!m_chunk->file.seek(offset)) {
+        m_chunkResult = FS_ERROR;
+    }
+    else {
+        m_writer.begin(m_chunk->file);
+    }
+    return m_chunkResult;
+}
+
+void UploadSessionTable::writeChunk(const uint8_t *data, size_t length) {
+    if (!m_chunk || m_chunkResult != OK) {
+        return;
+    }
+    if (m_chunk->offset + m_chunkLength + length > m_chunk->size) {
+        m_chunkResult = BAD_OFFSET;
+        return;
+    }
+    m_chunkCrc = Crc32::update(m_chunkCrc, data, length);
+    m_chunkRunning = Crc32::update(m_chunkRunning, data, length);
+    m_chunkLength += length;
+    if (m_writer.write(data, length) != length) {
+        m_chunkResult = FS_ERROR;
+    }
+}
+
+UploadSessionTable::Result UploadSessionTable::endChunk() {
+    Result result = m_chunkResult;
+    m_chunkResult = NO_DATA;
+    if (!m_chunk) {
+        return result;
+    }
+    if (!m_writer.end() && result == OK) {
+        result = FS_ERROR;
+    }
+    if (result == OK && m_chunkCrc != m_chunkExpected) {
+        log_debug("Upload session %08x: bad CRC at offset %u", m_chunk->id, m_chunk->offset);
+        result = BAD_CRC;
+    }
+    if (result == OK) {
+        m_chunk->offset += m_chunkLength;
+        m_chunk->crc = m_chunkRunning;
+        m_chunk->file.flush();
+        // Not fatal: a session resumed after a reboot would only restart from an older offset
+        if (!saveAck(*m_chunk)) {
+            log_error("Can't write %s", m_chunk->ackPath().c_str());
+        }
+    }
+    m_chunk->lastUsed = millis();
+    m_chunk = nullptr;
+    return result;
+}
+
+UploadSessionTable::Result UploadSessionTable::commit(uint32_t id) {
+    UploadSession *session = find(id);
+    if (!session) {
+        return NOT_FOUND;
+    }
+    if (session->offset != session->size) {
+        return INCOMPLETE;
+    }
+
+    String part = session->partPath();
+    String path = session->path;
+    bool hashOk = !session->hasHash || session->crc == session->hash;
+    close(*session);
+    m_fs->remove(path + ESP_FS_WS_UPLOAD_PART_EXT ".ack");
+    if (!hashOk) {
+        m_fs->remove(part);
+        return BAD_HASH;
+    }
+
+    // LittleFS replaces the target atomically, other filesystems refuse to rename over it
+    if (!m_fs->rename(part, path)) {
+        m_fs->remove(path);
+        if (!m_fs->rename(part, path)) {
+            log_error("Can't rename %s", part.c_str());
+            return FS_ERROR;
+        }
+    }
+    log_debug("Upload session %08x committed: %s", id, path.c_str());
+    return OK;
+}
+
+void UploadSessionTable::abort(uint32_t id) {
+    UploadSession *session = find(id);
+    if (session) {
+        String path = session->path;
+        close(*session);
+        removePart(path);
+    }
+}
+
+void UploadSessionTable::close(UploadSession &session) {
+    if (m_chunk == &session) {
+        m_writer.end();
+        m_chunk = nullptr;
+    }
+    session.file.close();
+    session.id = 0;
+    session.path = "";
+}
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef UPLOAD_SESSION_H
+#define UPLOAD_SESSION_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "BlockWriter.h"
+
+// Resumable uploads in progress at the same time (0 disables the /upload endpoints)
+#ifndef ESP_FS_WS_UPLOAD_SESSIONS
+#define ESP_FS_WS_UPLOAD_SESSIONS 2
+#endif
+
+// Idle time (ms) after which a session may be evicted to make room for a new one.
+// The partial file is kept: starting again the same upload resumes it
+#ifndef ESP_FS_WS_UPLOAD_SESSION_TIMEOUT
+#define ESP_FS_WS_UPLOAD_SESSION_TIMEOUT 600000
+#endif
+
+// Suffix of the temporary file holding the data received so far
+#ifndef ESP_FS_WS_UPLOAD_PART_EXT
+#define ESP_FS_WS_UPLOAD_PART_EXT ".part"
+#endif
+
+#if ESP_FS_WS_UPLOAD_SESSIONS
+struct UploadSession {
+  uint32_t id = 0;            // 0 = free slot
+  String path;                // Final path, written on commit
+  uint32_t size = 0;          // Declared total size
+  uint32_t hash = 0;          // Declared CRC32 of the whole file, checked on commit if hasHash
+  bool hasHash = false;
+  uint32_t offset = 0;        // Bytes received and acknowledged
+  uint32_t crc = 0;           // CRC32 of the first offset bytes
+  uint32_t lastUsed = 0;
+  File file;                  // Temporary file, open while the session is active
+
+  inline String partPath() const { return path + ESP_FS_WS_UPLOAD_PART_EXT; }
+  // Acknowledged offset and CRC32, the only part of the temporary file trusted on resume
+  inline String ackPath() const { return path + ESP_FS_WS_UPLOAD_PART_EXT ".ack"; }
+};
+
+/*
+  Resumable upload sessions.
+  A file is sent as a sequence of chunks, each one with its own CRC32, to a temporary file
+  next to the target (path + ESP_FS_WS_UPLOAD_PART_EXT). A chunk is acknowledged only if
+  its checksum matches, so after a dropped connection the client asks for the session
+  status and carries on from the acknowledged offset. On commit the size (and the whole
+  file CRC32, if declared) is verified and the temporary file renamed over the target.
+*/
+class UploadSessionTable {
+public:
+  enum Result : uint8_t {
+    OK,
+    NOT_FOUND,      // Unknown session id
+    NO_SLOT,        // All sessions busy (and none idle)
+    BAD_OFFSET,     // Chunk doesn't start at the acknowledged offset, or runs past the size
+    BAD_CRC,        // Chunk checksum mismatch, the chunk must be sent again
+    INCOMPLETE,     // Commit before all the data was received
+    BAD_HASH,       // Whole file checksum mismatch, the upload is discarded
+    FS_ERROR,       // Filesystem refused to create, write or rename the file
+    NO_DATA         // Chunk request without a body
+  };
+
+  explicit UploadSessionTable(fs::FS *fs) : m_fs(fs) {}
+
+  /*
+    Start (or resume) the upload of path. An active session for the same path and size,
+    or a temporary file left by an interrupted one, is resumed: offset tells the client
+    where to continue from. Only acknowledged chunks are resumed: data of a chunk that
+    failed its CRC or was cut off is written again
+  */
+  UploadSession *start(const String &path, uint32_t size, uint32_t hash, bool hasHash, Result &result);
+
+  UploadSession *find(uint32_t id);
+
+  /*
+    Receive a chunk (called from the raw body callbacks): beginChunk() checks the offset,
+    writeChunk() stores the data, endChunk() checks the CRC32 and advances the offset
+  */
+  Result beginChunk(uint32_t id, uint32_t offset, uint32_t crc);
+  void writeChunk(const uint8_t *data, size_t length);
+  Result endChunk();
+
+  /*
+    Verify the received file and move it to its final path. The session is closed
+    (on BAD_HASH the temporary file is deleted too)
+  */
+  Result commit(uint32_t id);
+
+  /*
+    Drop the session and delete its temporary file
+  */
+  void abort(uint32_t id);
+
+private:
+  fs::FS *m_fs;
+  UploadSession m_sessions[ESP_FS_WS_UPLOAD_SESSIONS];
+
+  // Chunk being received
+  UploadSession *m_chunk = nullptr;
+  Result m_chunkResult = NO_DATA;
+  uint32_t m_chunkExpected = 0;
+  uint32_t m_chunkCrc = 0;      // CRC32 of the chunk
+  uint32_t m_chunkRunning = 0;  // CRC32 of the file including the chunk
+  uint32_t m_chunkLength = 0;
+  BlockWriter m_writer;
+
+  void close(UploadSession &session);
+  bool resumePart(UploadSession &session);
+  bool saveAck(const UploadSession &session);
+  void removePart(const String &path);
+};
+#endif
+
+#endif
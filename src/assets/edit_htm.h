@@ -2,428 +2,459 @@
 #pragma once
 #include <pgmspace.h>
 
-const uint8_t _acedit_htm[6758] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0xed, 0x3d, 0xe9, 0x6e, 0x23, 0xc9, 
-  0x79, 0xff, 0x17, 0xd8, 0x77, 0x28, 0xf5, 0xcc, 0x0e, 0xbb, 0x57, 0x64, 0x93, 0xd2, 0x1c, 0xf0, 
-  0x50, 0xa2, 0xe4, 0x39, 0xbd, 0x13, 0xcf, 0x85, 0xd1, 0x8c, 0x0f, 0xc8, 0xda, 0xa0, 0xd8, 0x5d, 
-  0x24, 0x6b, 0xd4, 0xac, 0x6a, 0x77, 0x15, 0x25, 0x6a, 0xbd, 0x0a, 0xe0, 0x60, 0xe1, 0xfc, 0x34, 
-  0x9c, 0xc3, 0xf9, 0x93, 0xc4, 0x2f, 0xe0, 0x07, 0x48, 0x82, 0x20, 0x0f, 0xe3, 0x17, 0x88, 0x1f, 
-  0x21, 0xf8, 0xaa, 0xba, 0xc9, 0x3e, 0xaa, 0xba, 0x9b, 0x92, 0xc6, 0xb0, 0x83, 0xcc, 0x00, 0x43, 
-  0x4e, 0x77, 0x1d, 0x5f, 0x7d, 0x57, 0x7d, 0x57, 0x15, 0xf7, 0x67, 0x72, 0x1e, 0xa1, 0x08, 0xb3, 
-  0xe9, 0x88, 0xb0, 0x83, 0xcf, 0x3f, 0x43, 0x08, 0xa1, 0xfd, 0x39, 0x91, 0x18, 0x05, 0x33, 0x9c, 
-  0x08, 0x22, 0x47, 0xce, 0x42, 0x4e, 0x7a, 0xdf, 0x73, 0xb2, 0x77, 0x92, 0xca, 0x88, 0x1c, 0x3c, 
-  0xa7, 0x11, 0x41, 0x73, 0xcc, 0xf0, 0x94, 0x24, 0xfb, 0x7d, 0xfd, 0x2c, 0x6d, 0x20, 0xe4, 0x05, 
-  0xbc, 0x23, 0x21, 0xc5, 0x23, 0x11, 0x24, 0x64, 0x35, 0x2c, 0xfc, 0x19, 0xf3, 0xf0, 0x02, 0xfd, 
-  0x62, 0xfd, 0x7f, 0xf8, 0x33, 0xe1, 0x4c, 0xf6, 0x04, 0xfd, 0x86, 0x0c, 0xd1, 0xce, 0x6e, 0xbc, 
-  0xdc, 0x33, 0xbc, 0x9d, 0xe0, 0x39, 0x8d, 0x2e, 0x86, 0xe8, 0x47, 0x24, 0x09, 0x31, 0xc3, 0xdd, 
-  0x47, 0x09, 0xc5, 0x51, 0xf7, 0x08, 0x33, 0xd1, 0x13, 0x24, 0xa1, 0x93, 0x75, 0x97, 0xcb, 0xcf, 
-  0x3f, 0xcb, 0xcd, 0xb6, 0x90, 0x92, 0xb3, 0xf2, 0x7c, 0x67, 0x24, 0x91, 0x34, 0xc0, 0x51, 0x0f, 
-  0x47, 0x74, 0xca, 0x86, 0x68, 0x4e, 0xc3, 0x30, 0x22, 0xa5, 0x69, 0x67, 0x84, 0x4e, 0x67, 0x72, 
-  0x88, 0x76, 0xab, 0x10, 0x85, 0x54, 0xc4, 0x11, 0xbe, 0x18, 0x22, 0xca, 0x22, 0xca, 0x48, 0x6f, 
-  0x12, 0x91, 0x72, 0x13, 0x35, 0x72, 0x8f, 0x4a, 0x32, 0x17, 0x43, 0x14, 0x10, 0x26, 0x49, 0x52, 
-  0x6a, 0xf1, 0x71, 0x21, 0x24, 0x9d, 0x5c, 0xf4, 0x02, 0xce, 0x24, 0x61, 0xd2, 0xd0, 0xaa, 0xb0, 
-  0x12, 0xca, 0xe2, 0x85, 0xdc, 0x74, 0x1d, 0x85, 0x11, 0x7c, 0x35, 0xd3, 0x52, 0xbe, 0x22, 0x6c, 
-  0x51, 0xc6, 0xc8, 0x37, 0x3d, 0xca, 0x42, 0xb2, 0x1c, 0xa2, 0xbb, 0x83, 0x41, 0x09, 0xce, 0x98, 
-  0x0b, 0x2a, 0x29, 0x67, 0x43, 0x84, 0xc7, 0x82, 0x47, 0x0b, 0x59, 0x46, 0x54, 0x44, 0x26, 0x72, 
-  0x88, 0xee, 0x57, 0xb0, 0x34, 0xe6, 0x49, 0x48, 0x92, 0x21, 0xda, 0x89, 0x97, 0x48, 0xf0, 0x88, 
-  0x86, 0xe8, 0x56, 0x10, 0x04, 0xc6, 0x46, 0xbd, 0x04, 0x87, 0x74, 0x21, 0x86, 0xe8, 0x5e, 0x75, 
-  0x14, 0x1c, 0x9c, 0x4e, 0x13, 0xbe, 0x60, 0x61, 0x2f, 0xe0, 0x11, 0x4f, 0x86, 0xe8, 0xd6, 0x64, 
-  0x32, 0xb1, 0x11, 0x84, 0x71, 0x46, 0x2a, 0x33, 0x2c, 0x7b, 0x62, 0x86, 0x43, 0x7e, 0x3e, 0x44, 
-  0x03, 0xb4, 0x1b, 0x2f, 0xd1, 0xf7, 0xe2, 0x25, 0x4a, 0xa6, 0x63, 0xec, 0x0e, 0xba, 0xf0, 0xd7, 
-  0xdf, 0xb9, 0xef, 0xed, 0xd9, 0x19, 0xf2, 0xae, 0x99, 0x21, 0xcf, 0x53, 0xf6, 0xb8, 0x57, 0x41, 
-  0x58, 0x81, 0x5f, 0x7b, 0x38, 0x8e, 0x23, 0xd2, 0x13, 0x17, 0x42, 0x92, 0x79, 0x17, 0x3d, 0x8e, 
-  0x28, 0x3b, 0x7d, 0x85, 0x83, 0x23, 0xf5, 0xff, 0xe7, 0x9c, 0xc9, 0x2e, 0xea, 0x1c, 0x91, 0x29, 
-  0x27, 0xe8, 0xc3, 0x8b, 0x4e, 0x17, 0xbd, 0xe3, 0x63, 0x2e, 0x79, 0x17, 0x89, 0x15, 0x63, 0x17, 
-  0xa9, 0x69, 0xa4, 0xe5, 0x22, 0x2a, 0x93, 0x33, 0xa2, 0x42, 0xf6, 0x94, 0x18, 0x1a, 0x51, 0x32, 
-  0xc7, 0xc9, 0x94, 0xb2, 0x21, 0xaa, 0x90, 0x1a, 0x87, 0x21, 0x65, 0x53, 0x45, 0x86, 0xc2, 0xcb, 
-  0xdc, 0xcc, 0x16, 0x18, 0x22, 0x5a, 0x86, 0x61, 0xcd, 0x37, 0x09, 0x89, 0xb0, 0xa4, 0x67, 0x15, 
-  0x28, 0x28, 0xeb, 0x9d, 0xd3, 0x50, 0xce, 0x86, 0x68, 0xe7, 0xfe, 0xa0, 0x82, 0xe5, 0x60, 0x91, 
-  0x08, 0x20, 0x77, 0xcc, 0xa9, 0x41, 0x7a, 0x1a, 0x56, 0xb8, 0x5a, 0x09, 0xd0, 0x7a, 0xe7, 0x41, 
-  0x65, 0x70, 0x1b, 0x06, 0x64, 0x82, 0x59, 0x06, 0x76, 0x99, 0xf3, 0xd0, 0xc0, 0xdf, 0xb9, 0x2f, 
-  0x10, 0xc1, 0xa2, 0x9d, 0x88, 0x45, 0x74, 0x38, 0xe3, 0x67, 0x24, 0x29, 0x23, 0x66, 0x3d, 0x2e, 
-  0xf0, 0xf2, 0x00, 0xfe, 0x6e, 0x36, 0x9e, 0x88, 0x71, 0x45, 0xa5, 0x65, 0xb2, 0x31, 0x18, 0xb4, 
-  0x1b, 0x6c, 0x56, 0x05, 0x2b, 0x15, 0xd7, 0x81, 0x59, 0x42, 0x25, 0x8f, 0x0b, 0xa2, 0x4c, 0x06, 
-  0xf0, 0xd7, 0x82, 0x56, 0x03, 0xff, 0xe4, 0xe1, 0x10, 0xa2, 0x27, 0x13, 0x42, 0xce, 0x28, 0x39, 
-  0x47, 0x11, 0xed, 0x16, 0x1f, 0x54, 0xb9, 0x79, 0x45, 0xcc, 0x41, 0x4b, 0x2a, 0xb6, 0x63, 0x0e, 
-  0xbd, 0xa4, 0xdd, 0x78, 0xd9, 0x0a, 0x4e, 0xa5, 0x7f, 0xed, 0x3c, 0x6e, 0xd1, 0x8d, 0x3c, 0xc6, 
-  0x01, 0x95, 0x17, 0x43, 0x34, 0x68, 0x35, 0x49, 0xcd, 0xbe, 0xb8, 0x53, 0xe1, 0xe1, 0xde, 0x9c, 
-  0x7f, 0xd3, 0x5b, 0x08, 0x92, 0xf4, 0x04, 0x89, 0x48, 0x20, 0x8d, 0x6b, 0xed, 0x9d, 0x93, 0xf1, 
-  0x29, 0x95, 0x8d, 0xed, 0x2a, 0xef, 0x5b, 0xc1, 0x5b, 0xcf, 0x89, 0x93, 0x7a, 0x89, 0x6e, 0x3d, 
-  0x83, 0x59, 0x8c, 0x80, 0x95, 0x7b, 0x21, 0x09, 0x78, 0x82, 0x35, 0x09, 0x16, 0x2c, 0x24, 0x09, 
-  0xec, 0xc7, 0xed, 0xe9, 0xb9, 0x1d, 0xe1, 0x31, 0x89, 0xb6, 0xab, 0x2c, 0xb7, 0xe2, 0x2c, 0xf5, 
-  0x77, 0x77, 0x23, 0x26, 0xf9, 0x9b, 0xea, 0x70, 0x85, 0xfd, 0xa9, 0x9d, 0x58, 0x00, 0x60, 0x5d, 
-  0xc3, 0xb3, 0xe1, 0x70, 0x4c, 0x26, 0x3c, 0x21, 0x15, 0xb4, 0x5f, 0x01, 0xb9, 0x0a, 0xdc, 0x61, 
-  0x48, 0x05, 0x1e, 0x47, 0x24, 0xd4, 0xc8, 0xb0, 0x8d, 0x1b, 0x92, 0x09, 0x5e, 0x44, 0xd2, 0xc6, 
-  0xdf, 0xfe, 0x83, 0x0d, 0x66, 0x0c, 0x66, 0x24, 0x38, 0x25, 0xe1, 0x90, 0x71, 0xe9, 0xae, 0xa6, 
-  0xf7, 0xea, 0xf0, 0x36, 0x8e, 0x78, 0x70, 0x7a, 0x33, 0x88, 0xeb, 0x56, 0x19, 0xcc, 0xf0, 0xc8, 
-  0x86, 0xe6, 0xb2, 0xe9, 0xa7, 0x00, 0xb3, 0x58, 0x8e, 0x86, 0x7d, 0x47, 0xf5, 0xa9, 0x79, 0x6f, 
-  0xb6, 0xe8, 0xda, 0x2f, 0xdc, 0xca, 0x1d, 0x99, 0x91, 0xe9, 0xfc, 0xf1, 0x77, 0xff, 0xf0, 0x4b, 
-  0xe4, 0xec, 0xa1, 0xfe, 0x97, 0xe8, 0x39, 0x8f, 0x42, 0x92, 0x20, 0x1a, 0x70, 0x86, 0xbe, 0xec, 
-  0x17, 0x3b, 0xa4, 0x1b, 0x33, 0x5e, 0x48, 0xde, 0x52, 0xe9, 0x6e, 0x6a, 0x8c, 0x5a, 0xd9, 0x62, 
-  0xbb, 0xfd, 0x4a, 0xfe, 0x36, 0x5d, 0xc9, 0x9b, 0x98, 0x30, 0x34, 0xb1, 0x2c, 0xa7, 0x49, 0xbb, 
-  0xb4, 0x99, 0xe8, 0xbb, 0x74, 0xa2, 0xa7, 0x5a, 0x0a, 0xd0, 0x04, 0xbc, 0x9f, 0x1b, 0x40, 0x5c, 
-  0x03, 0x6c, 0xbe, 0x5c, 0xca, 0x56, 0xf0, 0xfd, 0x6b, 0x0a, 0xdf, 0x7b, 0xb2, 0xb4, 0x01, 0xd7, 
-  0x34, 0x15, 0x9d, 0x4f, 0xdb, 0x4c, 0xf5, 0xdb, 0xff, 0xfa, 0x9f, 0x7f, 0xff, 0x75, 0x3a, 0xdb, 
-  0x8b, 0x39, 0x9e, 0x92, 0x36, 0xd3, 0xdd, 0x9a, 0x11, 0x1c, 0x56, 0x55, 0x78, 0xe3, 0xf6, 0xa9, 
-  0x76, 0xe8, 0x32, 0xa3, 0x25, 0x5a, 0x7a, 0x06, 0x46, 0x37, 0x64, 0x60, 0xf3, 0xe2, 0xaa, 0x9e, 
-  0xc5, 0xca, 0xac, 0x00, 0xab, 0x46, 0x29, 0xfa, 0x66, 0xd7, 0xe3, 0xde, 0xbd, 0x7b, 0x7b, 0xe6, 
-  0xed, 0x8e, 0x10, 0x9b, 0x98, 0xde, 0x02, 0x3c, 0x5f, 0x6d, 0xe9, 0xbb, 0x26, 0xaf, 0x4a, 0x4a, 
-  0x3e, 0x6f, 0xbb, 0xfc, 0x94, 0x1b, 0x77, 0x07, 0x5f, 0xd4, 0x18, 0xc8, 0x36, 0xb8, 0x49, 0x48, 
-  0x25, 0x4f, 0xba, 0xb7, 0xe2, 0xc4, 0x68, 0x9d, 0x5c, 0x79, 0x09, 0x16, 0x02, 0xd6, 0xaf, 0x6c, 
-  0x77, 0xf0, 0x85, 0x0d, 0x4e, 0x0b, 0x7c, 0x06, 0xf2, 0x11, 0x62, 0x75, 0x14, 0xee, 0xdb, 0xf1, 
-  0x20, 0x24, 0x96, 0x0b, 0x71, 0xb5, 0xe5, 0xdf, 0xb5, 0xad, 0x7e, 0x67, 0x60, 0xf6, 0x2b, 0x53, 
-  0x73, 0xaf, 0x06, 0x9c, 0x89, 0x78, 0x45, 0x64, 0x55, 0x98, 0x32, 0x57, 0x6a, 0x30, 0xb0, 0x71, 
-  0x7a, 0x2f, 0xc3, 0xb0, 0xdd, 0x9c, 0xb9, 0x75, 0x8e, 0x13, 0x46, 0xd9, 0xb4, 0x3c, 0xf8, 0x6a, 
-  0xcb, 0x1a, 0x54, 0x38, 0xa9, 0x8a, 0x66, 0x9e, 0x60, 0x36, 0x25, 0x7b, 0x56, 0x07, 0xc5, 0xa6, 
-  0x93, 0x24, 0xe7, 0x91, 0xa4, 0xf1, 0xc6, 0x88, 0x5e, 0x05, 0x2f, 0x76, 0xdb, 0x31, 0x9a, 0xe6, 
-  0xcb, 0x2a, 0x9a, 0xce, 0xa8, 0xa0, 0x63, 0x1a, 0x29, 0x7b, 0x66, 0x46, 0xc3, 0x90, 0xb0, 0xab, 
-  0xc4, 0x22, 0xcc, 0x9e, 0xd8, 0xca, 0x62, 0x4d, 0x77, 0x47, 0x63, 0x48, 0xc8, 0x10, 0x31, 0xa9, 
-  0x8e, 0xb2, 0xe2, 0xd8, 0xbb, 0xb5, 0x0c, 0x34, 0x68, 0xa4, 0x71, 0x6a, 0x56, 0xdb, 0xd0, 0x9e, 
-  0xc7, 0x86, 0xfa, 0x6e, 0xb5, 0x43, 0x6e, 0x45, 0x1c, 0x87, 0x06, 0xa6, 0x69, 0x27, 0x21, 0xbd, 
-  0x9d, 0xc1, 0xe0, 0x6c, 0xb6, 0x89, 0x36, 0x83, 0x0e, 0xe7, 0x7b, 0x56, 0x06, 0xad, 0x0c, 0xb6, 
-  0xe2, 0x8f, 0x9d, 0x41, 0xb3, 0x8a, 0xcf, 0x07, 0x86, 0x2a, 0x71, 0xa1, 0xb5, 0x3b, 0x57, 0x13, 
-  0x37, 0x48, 0x1b, 0x21, 0x3f, 0x0d, 0x16, 0xf4, 0x28, 0xeb, 0xf1, 0x85, 0x6c, 0x40, 0x9e, 0x2f, 
-  0x66, 0xfc, 0xbc, 0xe2, 0x4c, 0x19, 0x37, 0xc0, 0x15, 0x14, 0x3b, 0x0d, 0x63, 0xf6, 0xe6, 0x62, 
-  0x7a, 0x15, 0x03, 0xf6, 0x6a, 0xfb, 0x72, 0x1a, 0x07, 0xac, 0x28, 0x08, 0x85, 0x9b, 0x09, 0x4f, 
-  0xe6, 0x43, 0xfd, 0x35, 0xc2, 0x92, 0xfc, 0xc4, 0xed, 0xdd, 0x1f, 0x7c, 0xe1, 0x59, 0x44, 0xa7, 
-  0x2a, 0x54, 0x39, 0xce, 0xbe, 0x6b, 0xd7, 0x5e, 0xdf, 0x3f, 0x25, 0x17, 0x93, 0x04, 0xcf, 0x89, 
-  0x40, 0x22, 0xa6, 0x8c, 0x91, 0xa4, 0x87, 0x19, 0x9d, 0x97, 0x51, 0x30, 0xf8, 0xa2, 0xfc, 0xa4, 
-  0x04, 0x66, 0xc2, 0x25, 0x96, 0xc4, 0x1d, 0x78, 0xc5, 0x56, 0x85, 0xb9, 0xe0, 0x0f, 0x68, 0xc3, 
-  0x76, 0x43, 0xdd, 0x7d, 0x30, 0x08, 0xc9, 0xb4, 0x3a, 0x9e, 0x59, 0x11, 0xe6, 0x81, 0xd7, 0x4e, 
-  0x52, 0x42, 0x7e, 0xbe, 0xa0, 0x09, 0x09, 0xbd, 0xeb, 0x91, 0xd3, 0x12, 0x89, 0x53, 0xe4, 0xac, 
-  0x12, 0x6e, 0x13, 0x82, 0x2a, 0x7a, 0x76, 0x4d, 0x44, 0x85, 0x45, 0xa4, 0x1e, 0x7a, 0x81, 0x28, 
-  0x3b, 0x02, 0x51, 0x36, 0xa1, 0x8c, 0x4a, 0xa2, 0xdc, 0x22, 0x6c, 0xd5, 0x86, 0x0f, 0x72, 0x51, 
-  0x27, 0x42, 0x2c, 0x01, 0x64, 0x10, 0xff, 0x4c, 0x86, 0x15, 0x54, 0x31, 0x4e, 0x08, 0x93, 0xf5, 
-  0xe1, 0xe6, 0xbb, 0xbb, 0x06, 0xfb, 0x6a, 0x09, 0x8c, 0xa6, 0x34, 0x6c, 0xda, 0x7a, 0xcc, 0xcb, 
-  0x8d, 0x40, 0x71, 0x4e, 0x22, 0x88, 0x28, 0x1b, 0xf7, 0x09, 0xa5, 0xe8, 0x41, 0xe7, 0x80, 0xcd, 
-  0xdc, 0x7b, 0xf8, 0xf0, 0xe1, 0xc3, 0xca, 0x34, 0xa9, 0x2a, 0x7b, 0x50, 0x35, 0x4b, 0x33, 0x4d, 
-  0x06, 0xaf, 0x2a, 0x11, 0xd8, 0xfd, 0xbe, 0x0a, 0x6b, 0xad, 0x32, 0x2d, 0x41, 0x42, 0x63, 0x89, 
-  0x44, 0x12, 0x8c, 0x9c, 0x99, 0x94, 0xb1, 0x18, 0xf6, 0xfb, 0x41, 0xc8, 0xfc, 0x8f, 0x22, 0x24, 
-  0x11, 0x3d, 0x4b, 0x7c, 0x46, 0x64, 0x9f, 0xc5, 0xf3, 0x3e, 0x0e, 0x48, 0x6f, 0xbc, 0xa0, 0x51, 
-  0x28, 0xbe, 0xbf, 0xe3, 0xdf, 0xbb, 0xeb, 0xdf, 0xed, 0x8b, 0x24, 0xe8, 0x41, 0x04, 0x96, 0xf1, 
-  0x80, 0xb3, 0x49, 0x44, 0x03, 0x09, 0x8d, 0xfc, 0x39, 0x85, 0xde, 0xce, 0xc1, 0x7e, 0x5f, 0x8f, 
-  0x9d, 0xce, 0x54, 0x98, 0x2f, 0x97, 0xcd, 0x39, 0xc3, 0x09, 0x02, 0xf3, 0xb6, 0x8b, 0x26, 0xe2, 
-  0x05, 0x9b, 0xe4, 0x5d, 0x9e, 0x80, 0x33, 0x21, 0xd1, 0x6d, 0x34, 0x42, 0x93, 0x05, 0x0b, 0x80, 
-  0x01, 0x5c, 0x52, 0x61, 0xdf, 0x84, 0xc8, 0x45, 0xc2, 0x50, 0xc8, 0x83, 0xc5, 0x9c, 0x30, 0xe9, 
-  0x4f, 0x89, 0x7c, 0x16, 0x11, 0xf8, 0xfa, 0xf8, 0xe2, 0x45, 0xe8, 0x12, 0xcf, 0x18, 0x83, 0xd6, 
-  0x43, 0x07, 0x11, 0x17, 0x44, 0x05, 0x33, 0x6b, 0xa7, 0xa0, 0x13, 0xe4, 0xae, 0xc6, 0x87, 0xec, 
-  0x53, 0x6e, 0x12, 0xf1, 0xf8, 0xe2, 0x49, 0x84, 0x85, 0x78, 0x8d, 0xe7, 0xc4, 0x75, 0x72, 0xf1, 
-  0x51, 0xc7, 0xf3, 0x23, 0xc2, 0xa6, 0x72, 0xe6, 0xa1, 0x62, 0xdf, 0x84, 0xcc, 0xf9, 0x19, 0x79, 
-  0x32, 0xa3, 0x11, 0x40, 0x67, 0x0e, 0x91, 0x23, 0xd4, 0x45, 0x8c, 0x9c, 0x3f, 0x9b, 0x6f, 0xb6, 
-  0xf6, 0x20, 0x21, 0x58, 0x92, 0x14, 0xb2, 0xe2, 0xd2, 0x73, 0xf3, 0x64, 0x03, 0x22, 0x41, 0xe4, 
-  0x4b, 0xad, 0xe6, 0x5d, 0xd2, 0x45, 0xac, 0x32, 0xfc, 0x6d, 0xd7, 0xc9, 0x6d, 0x03, 0x8e, 0xe7, 
-  0x2b, 0xd9, 0xfb, 0xea, 0xfd, 0xab, 0x97, 0x68, 0x84, 0x18, 0xfa, 0xf6, 0x5b, 0xe4, 0x38, 0xdd, 
-  0x62, 0x17, 0x82, 0x0e, 0x73, 0xdd, 0x1c, 0xcf, 0x0f, 0x00, 0x39, 0x2f, 0xa9, 0x90, 0x3e, 0x0e, 
-  0x43, 0xd7, 0x51, 0x5b, 0x94, 0xe3, 0xa1, 0xa1, 0xad, 0x95, 0xc6, 0xce, 0xaa, 0x61, 0x69, 0xf8, 
-  0x22, 0x26, 0x15, 0x23, 0xfb, 0x3a, 0xbc, 0x84, 0x46, 0x6a, 0x6e, 0xe7, 0x1c, 0x53, 0xe9, 0xa0, 
-  0x21, 0x72, 0xd2, 0x68, 0x93, 0x63, 0xc4, 0xef, 0x0a, 0x05, 0x09, 0xc1, 0x21, 0xc4, 0x8e, 0x8e, 
-  0xe8, 0x37, 0xc4, 0x42, 0x79, 0x82, 0xf6, 0xd1, 0xce, 0x60, 0xf7, 0x9e, 0x57, 0xd5, 0xd2, 0x29, 
-  0xfe, 0x09, 0xda, 0x46, 0x0e, 0x7a, 0xec, 0x54, 0x76, 0x9c, 0x04, 0xb9, 0xc0, 0xde, 0x0c, 0x8d, 
-  0x50, 0x6f, 0x67, 0x0f, 0xb1, 0xed, 0xed, 0x6e, 0x59, 0xfd, 0xef, 0xde, 0x43, 0xfb, 0x30, 0x47, 
-  0x7f, 0xa4, 0x27, 0xd9, 0x43, 0x86, 0x79, 0xf6, 0x8c, 0x64, 0x27, 0xbe, 0xe4, 0xcf, 0xe9, 0x92, 
-  0x84, 0xee, 0xae, 0x87, 0xb6, 0xd1, 0xb1, 0x83, 0x7e, 0x48, 0x1f, 0x3b, 0x5d, 0xe4, 0xa0, 0x57, 
-  0xe9, 0xe7, 0x0f, 0xd2, 0xcf, 0xf7, 0xfa, 0xf3, 0x2d, 0x7d, 0xec, 0x9c, 0x1c, 0xb3, 0x93, 0x26, 
-  0x94, 0x4c, 0x12, 0x22, 0x66, 0x47, 0xca, 0x65, 0x71, 0x4d, 0x4c, 0xa1, 0xbd, 0x99, 0x12, 0x3f, 
-  0x38, 0x6e, 0xda, 0x11, 0x2c, 0x11, 0xdf, 0xf7, 0xca, 0xd8, 0x00, 0x44, 0x10, 0xe0, 0x1b, 0x72, 
-  0x8e, 0x7e, 0xf2, 0xea, 0xe5, 0x57, 0x52, 0xc6, 0xef, 0xc8, 0xcf, 0x17, 0x44, 0x94, 0x15, 0x2c, 
-  0xf1, 0x39, 0x03, 0xce, 0xc8, 0xb3, 0xbe, 0x67, 0xda, 0x23, 0x15, 0x6a, 0xbb, 0xa8, 0xdc, 0x1f, 
-  0xfe, 0xec, 0x0e, 0x06, 0x68, 0x6b, 0x84, 0x88, 0x9f, 0x3a, 0x5e, 0x87, 0x08, 0xf8, 0x09, 0xe6, 
-  0x7c, 0x96, 0x24, 0x3c, 0x01, 0x4a, 0x0f, 0x91, 0x0b, 0x74, 0x71, 0xb5, 0xd6, 0x41, 0x23, 0xf4, 
-  0x57, 0x47, 0x6f, 0x5e, 0xfb, 0x31, 0xe4, 0xab, 0x5d, 0xe2, 0x27, 0x44, 0xc4, 0x9c, 0x09, 0x02, 
-  0xd1, 0x10, 0xcf, 0xf3, 0xe5, 0x45, 0xac, 0x89, 0xdc, 0x43, 0x65, 0x8e, 0x57, 0xb8, 0x53, 0x63, 
-  0xf8, 0x54, 0xbc, 0x39, 0x45, 0x87, 0x30, 0xee, 0xf6, 0x08, 0x39, 0x90, 0x01, 0x87, 0x60, 0x52, 
-  0x38, 0xea, 0xa4, 0xfe, 0x56, 0x07, 0x12, 0x56, 0xa3, 0xce, 0xa0, 0x83, 0x78, 0x2c, 0xe9, 0x7c, 
-  0x31, 0x87, 0xef, 0x11, 0x3f, 0x1f, 0x75, 0x1e, 0x0e, 0x3a, 0x68, 0x46, 0xa7, 0xb3, 0x51, 0xe7, 
-  0xe1, 0xfd, 0x0e, 0x9a, 0xe3, 0xe5, 0xa8, 0xb3, 0x33, 0x18, 0x74, 0xd0, 0x19, 0x8e, 0x16, 0x64, 
-  0xd4, 0x71, 0xd0, 0x36, 0x72, 0x77, 0xd0, 0x36, 0x7a, 0x85, 0xe5, 0xcc, 0x57, 0xc6, 0xa6, 0xfb, 
-  0xf0, 0x21, 0xfa, 0x32, 0x9b, 0x78, 0x21, 0x48, 0xf8, 0xf8, 0x42, 0x12, 0x81, 0xfa, 0xd9, 0x23, 
-  0xc9, 0x25, 0x8e, 0xd4, 0x33, 0x0f, 0x98, 0xc3, 0xe9, 0x20, 0x95, 0x60, 0x4f, 0xc7, 0x92, 0x68, 
-  0x54, 0x64, 0xfd, 0x4a, 0x2f, 0xd4, 0xab, 0x0c, 0xae, 0xc6, 0x41, 0x13, 0x08, 0x45, 0xf0, 0x09, 
-  0x82, 0x71, 0xea, 0x87, 0x48, 0x27, 0x3e, 0x80, 0x96, 0x12, 0xbe, 0xee, 0xf7, 0x15, 0x4a, 0x0e, 
-  0x6a, 0x50, 0xb8, 0x60, 0x62, 0x11, 0xc7, 0x3c, 0x91, 0x24, 0x84, 0xf2, 0x00, 0x81, 0xee, 0xdc, 
-  0xc9, 0xf0, 0x89, 0xf6, 0x55, 0xae, 0x00, 0xf0, 0x99, 0xba, 0x1f, 0x9d, 0x83, 0x1f, 0x3f, 0x7a, 
-  0xf7, 0xfa, 0xc5, 0xeb, 0x1f, 0xe8, 0x37, 0x4a, 0x89, 0x8c, 0x3a, 0xa9, 0x33, 0xd2, 0x51, 0xf5, 
-  0x05, 0x3a, 0x6b, 0xaa, 0xc2, 0x4f, 0x98, 0x32, 0x81, 0x72, 0xe3, 0xab, 0xa8, 0x13, 0x03, 0x53, 
-  0x6f, 0xb8, 0x3f, 0x4e, 0xfa, 0x0a, 0x4c, 0x1b, 0x14, 0x0a, 0x78, 0x98, 0xe4, 0x20, 0xfd, 0x70, 
-  0x3c, 0xe0, 0xa0, 0x94, 0xd0, 0x6a, 0x76, 0xa5, 0x8c, 0x46, 0x9d, 0x8a, 0x3b, 0x90, 0x90, 0x70, 
-  0x4f, 0x7f, 0x3b, 0x9f, 0x51, 0x49, 0xf6, 0xf2, 0xa9, 0xdf, 0x31, 0x8f, 0xc2, 0xce, 0xc1, 0x8b, 
-  0xd7, 0x2f, 0xde, 0xa3, 0x67, 0xef, 0xde, 0xbd, 0x79, 0x87, 0xb6, 0xb2, 0xe1, 0x0d, 0x18, 0xb2, 
-  0x09, 0x1e, 0x33, 0xb4, 0x75, 0x8e, 0xde, 0xbe, 0x78, 0xfe, 0xfc, 0xc8, 0x01, 0x21, 0xc8, 0xe8, 
-  0x02, 0x2c, 0x0c, 0xd8, 0xbc, 0xed, 0x3a, 0xf3, 0xd3, 0x90, 0x26, 0x8e, 0x97, 0x2a, 0xd0, 0xd4, 
-  0x00, 0x04, 0x19, 0xd6, 0x26, 0xa0, 0xe3, 0xd9, 0xcd, 0x4c, 0xb5, 0x37, 0x55, 0x04, 0x36, 0x26, 
-  0xcc, 0x75, 0x7e, 0xf0, 0xec, 0x3d, 0x68, 0x99, 0x7e, 0x0a, 0x65, 0x17, 0x6d, 0x0d, 0xbc, 0x4a, 
-  0x53, 0x41, 0x58, 0xe8, 0xb2, 0x45, 0x14, 0x79, 0xf5, 0x5a, 0xa8, 0x22, 0xaf, 0xbf, 0x28, 0x57, 
-  0x47, 0x90, 0x44, 0xba, 0x8e, 0x42, 0xdb, 0x10, 0x74, 0xdf, 0xf6, 0x5a, 0xda, 0xb7, 0x91, 0x73, 
-  0x82, 0xf4, 0x93, 0x82, 0x1c, 0xd7, 0xcf, 0x18, 0x60, 0x06, 0xbb, 0xe1, 0x6b, 0x72, 0xfe, 0x44, 
-  0x07, 0x2b, 0x0d, 0xca, 0x2f, 0xd5, 0xbc, 0x5b, 0x5b, 0x40, 0x0c, 0x7c, 0x46, 0x1e, 0x4b, 0xe6, 
-  0x78, 0x7e, 0x96, 0x7f, 0x80, 0x1d, 0x71, 0x6b, 0x0b, 0x8c, 0x21, 0x9a, 0xcc, 0x5d, 0xe7, 0xc9, 
-  0x0c, 0x82, 0x18, 0x02, 0x49, 0x8e, 0x2e, 0xf8, 0x22, 0x59, 0x6d, 0x5e, 0xe8, 0x9c, 0x46, 0x11, 
-  0x1a, 0x13, 0x14, 0x71, 0x21, 0x61, 0x8b, 0xb9, 0xe0, 0x0b, 0xc5, 0xa1, 0x94, 0x2d, 0x88, 0xe3, 
-  0x29, 0x22, 0x11, 0xa6, 0xe4, 0x0a, 0x9f, 0x91, 0xa7, 0x54, 0x04, 0x38, 0x09, 0x1f, 0x4b, 0x26, 
-  0xdc, 0xad, 0x9d, 0x32, 0x42, 0xb7, 0x06, 0x0d, 0xab, 0x32, 0x0f, 0x44, 0x8c, 0x6a, 0xbd, 0xba, 
-  0xa0, 0x11, 0xda, 0x22, 0xdd, 0x4a, 0xc3, 0x70, 0x35, 0x52, 0xb9, 0x6d, 0x3d, 0x2c, 0x53, 0x22, 
-  0xdf, 0x2a, 0x93, 0x5a, 0xa7, 0x0d, 0xec, 0x06, 0x8d, 0x0b, 0x1b, 0x85, 0xfa, 0x47, 0xd1, 0x34, 
-  0x91, 0xe2, 0xc7, 0x54, 0xce, 0x5c, 0xa7, 0xef, 0x78, 0xe8, 0x10, 0x11, 0xd8, 0xde, 0xfb, 0x8a, 
-  0xbe, 0x9e, 0x4f, 0x58, 0x58, 0x7c, 0xe9, 0x8b, 0x88, 0x06, 0xc4, 0x1d, 0x74, 0x51, 0x6f, 0x07, 
-  0x64, 0x94, 0x78, 0xbe, 0x58, 0x8c, 0x85, 0x4c, 0xc0, 0xcc, 0x19, 0x74, 0x11, 0xf1, 0x23, 0x2c, 
-  0xe4, 0x0b, 0x70, 0xe7, 0xdf, 0x4c, 0x54, 0xaf, 0x26, 0xbe, 0x50, 0x46, 0xd5, 0x57, 0x2a, 0xfc, 
-  0xac, 0xec, 0xa4, 0x2e, 0x92, 0x15, 0xc0, 0x61, 0x2f, 0xc2, 0x68, 0x84, 0x6e, 0x17, 0xac, 0xae, 
-  0xcc, 0x94, 0xa3, 0x7a, 0xdf, 0x7b, 0x36, 0x77, 0x1d, 0x95, 0xa7, 0x70, 0xca, 0x1e, 0x0e, 0xd5, 
-  0xe2, 0x39, 0x42, 0x0e, 0x28, 0xa5, 0xb2, 0xf4, 0x53, 0x7f, 0xbe, 0x00, 0x95, 0x16, 0x41, 0x8b, 
-  0xad, 0x9d, 0xca, 0x5b, 0x50, 0x62, 0xd0, 0x37, 0xc4, 0x12, 0x97, 0xfb, 0x62, 0x1f, 0xc7, 0x31, 
-  0x61, 0xa1, 0xb6, 0x37, 0xa9, 0x67, 0xd8, 0x95, 0x79, 0x13, 0x74, 0xdc, 0xa7, 0x40, 0x5e, 0x27, 
-  0xc6, 0x72, 0xf6, 0x42, 0xb5, 0xe8, 0x96, 0x1b, 0x64, 0xe0, 0x83, 0xf5, 0x5b, 0x7d, 0x9b, 0x01, 
-  0x08, 0x03, 0x54, 0xdf, 0xa6, 0x96, 0xda, 0x8f, 0x60, 0xaf, 0x83, 0x56, 0xfd, 0xfa, 0x35, 0x70, 
-  0xd3, 0x1a, 0xc4, 0x7a, 0x0d, 0xba, 0x60, 0xab, 0xb2, 0x08, 0x51, 0xb4, 0x56, 0xfe, 0xf0, 0xfb, 
-  0x5f, 0x41, 0x16, 0xe2, 0x43, 0x0c, 0xa6, 0x46, 0xfd, 0x84, 0xc2, 0x34, 0x61, 0xd4, 0x38, 0x61, 
-  0x94, 0x62, 0x4d, 0x2b, 0xdb, 0x6e, 0xf9, 0x65, 0x45, 0xf7, 0x42, 0x62, 0xb7, 0xda, 0xac, 0x00, 
-  0xb4, 0xca, 0xbc, 0xbd, 0x3a, 0x7d, 0x5a, 0x1d, 0xaf, 0x08, 0x71, 0x64, 0x82, 0x38, 0x6c, 0x84, 
-  0x38, 0xac, 0xcc, 0xf6, 0x1d, 0x7a, 0x75, 0xfa, 0xdc, 0xc0, 0x91, 0xc5, 0xe9, 0x42, 0xd3, 0x74, 
-  0xc9, 0x7a, 0x3a, 0xd8, 0xd2, 0x2a, 0x93, 0x25, 0x29, 0x7a, 0x74, 0x8a, 0xe0, 0xb1, 0x82, 0x48, 
-  0x94, 0xe7, 0x49, 0xda, 0xa1, 0xa9, 0x08, 0x4e, 0x62, 0x02, 0x27, 0x68, 0x5c, 0x7d, 0x90, 0x02, 
-  0x94, 0xa9, 0xc1, 0x6e, 0xe5, 0x75, 0x11, 0x39, 0x7f, 0xff, 0xdf, 0x08, 0xd4, 0x6a, 0xb5, 0x9d, 
-  0x06, 0x59, 0xe7, 0xea, 0x5e, 0x92, 0x09, 0xd8, 0x5a, 0xce, 0xdd, 0x41, 0xbc, 0xac, 0xb6, 0xcc, 
-  0xeb, 0xce, 0x41, 0x65, 0xe9, 0xf9, 0x35, 0x05, 0xa6, 0x35, 0xc5, 0x8d, 0x6b, 0x8a, 0xd3, 0x35, 
-  0xe5, 0x34, 0x76, 0xb7, 0xd2, 0xa2, 0x20, 0x16, 0xbf, 0xfa, 0x4f, 0x94, 0x6e, 0x14, 0xd5, 0x96, 
-  0xed, 0xc1, 0x8d, 0xcb, 0xfb, 0x94, 0x4b, 0xd6, 0xb0, 0x62, 0xc7, 0xf3, 0x52, 0xb8, 0x70, 0x40, 
-  0x5e, 0x52, 0x76, 0x5a, 0xf1, 0x22, 0x4b, 0x40, 0x7d, 0xf7, 0x1f, 0x20, 0xab, 0x8f, 0x02, 0x82, 
-  0x9e, 0x29, 0x6e, 0xa9, 0xb6, 0x9f, 0x25, 0x64, 0x02, 0x4d, 0xb3, 0x10, 0xc6, 0x94, 0xca, 0xd9, 
-  0x62, 0xec, 0x07, 0x7c, 0xde, 0xc7, 0x1f, 0xf1, 0x92, 0x27, 0x53, 0x88, 0x4d, 0xf4, 0xcf, 0xe9, 
-  0x29, 0xed, 0xa7, 0x19, 0xd8, 0xde, 0x0f, 0xc9, 0xc5, 0x98, 0xe3, 0x24, 0xec, 0x1d, 0xcd, 0x78, 
-  0x22, 0x83, 0x85, 0x14, 0xd5, 0x71, 0x25, 0x4e, 0xa6, 0x44, 0x51, 0xf0, 0xaf, 0xc7, 0x11, 0x36, 
-  0x41, 0x9a, 0x90, 0x48, 0xb3, 0x25, 0x18, 0x41, 0x24, 0x41, 0x8c, 0x27, 0x64, 0x42, 0x92, 0x84, 
-  0x18, 0xa0, 0x34, 0x71, 0xc6, 0x8e, 0x81, 0x33, 0xb2, 0x96, 0xba, 0x68, 0x6c, 0x84, 0x9c, 0x5b, 
-  0x83, 0xc1, 0x83, 0x07, 0x41, 0x60, 0x6b, 0x07, 0x5a, 0xf7, 0xe9, 0xaa, 0x8e, 0xc5, 0x26, 0x25, 
-  0x45, 0x12, 0x91, 0x0a, 0x89, 0x2a, 0x12, 0x9b, 0x51, 0x29, 0x33, 0xe8, 0x2a, 0x02, 0x5c, 0x70, 
-  0xff, 0x52, 0x6f, 0xde, 0x6b, 0x12, 0xce, 0xca, 0xf6, 0xc5, 0x59, 0xa0, 0x2c, 0xa5, 0xfa, 0x58, 
-  0xc7, 0xca, 0xe3, 0x33, 0xb8, 0x7b, 0xe0, 0xec, 0x8d, 0x10, 0xf5, 0x61, 0xf3, 0x14, 0x69, 0xd8, 
-  0x25, 0xf5, 0x1c, 0x56, 0x8f, 0x8f, 0x07, 0x27, 0x6a, 0x1f, 0x32, 0x58, 0xcb, 0xdc, 0x57, 0x7e, 
-  0x56, 0xc5, 0xd4, 0xf8, 0xf6, 0x5b, 0xe4, 0xa6, 0xef, 0xf4, 0xbe, 0x84, 0xb6, 0xb3, 0xb6, 0x9e, 
-  0x7d, 0x18, 0x34, 0xaa, 0x18, 0x3a, 0x59, 0x27, 0xb0, 0x4c, 0xd5, 0x28, 0x6c, 0x23, 0x03, 0x5b, 
-  0x00, 0x8a, 0x22, 0x1a, 0x9c, 0x36, 0x63, 0xc8, 0x86, 0x09, 0xe6, 0x83, 0x64, 0xe8, 0xdd, 0xce, 
-  0x5d, 0x63, 0xa4, 0xbb, 0x5a, 0xcf, 0x26, 0xf0, 0x84, 0xed, 0xe1, 0x51, 0xd1, 0x3d, 0x34, 0x5a, 
-  0xa1, 0x58, 0x26, 0x74, 0xee, 0x7a, 0x06, 0x12, 0x3a, 0x0e, 0x1a, 0x8d, 0x46, 0x48, 0xa2, 0xc3, 
-  0xcc, 0xb4, 0x7f, 0xb4, 0x72, 0xd0, 0xd0, 0x7c, 0x21, 0x24, 0x18, 0xcc, 0x53, 0x7a, 0x46, 0x74, 
-  0xf4, 0x48, 0x56, 0x0c, 0xbf, 0xb4, 0xd7, 0xf3, 0xcc, 0xa9, 0xd3, 0x9d, 0x18, 0x97, 0x88, 0xb0, 
-  0x10, 0x9d, 0x53, 0x39, 0x43, 0x18, 0x75, 0xfa, 0x1d, 0x55, 0x93, 0x8e, 0x03, 0x49, 0x12, 0x35, 
-  0x90, 0x46, 0xcc, 0x13, 0x65, 0xe3, 0xb9, 0x72, 0x23, 0x34, 0x44, 0x7f, 0x2a, 0x34, 0xe8, 0xaa, 
-  0x14, 0x0b, 0x26, 0xdc, 0x32, 0x2a, 0x80, 0x6b, 0xa5, 0x72, 0x4c, 0xfb, 0x8e, 0x89, 0x4d, 0x4b, 
-  0x2b, 0xde, 0x68, 0xc9, 0x41, 0xfb, 0x25, 0x4b, 0x1f, 0x36, 0x52, 0x77, 0xa3, 0xe1, 0xe3, 0x4d, 
-  0x86, 0x4f, 0xf7, 0x34, 0xb7, 0x36, 0x25, 0x62, 0xb1, 0xe6, 0xdf, 0x27, 0x84, 0x98, 0x63, 0x9e, 
-  0x19, 0xa5, 0x6e, 0xbb, 0x4e, 0x5a, 0x14, 0xe0, 0x18, 0x0c, 0x7a, 0xbc, 0x56, 0x95, 0x21, 0x3d, 
-  0x73, 0xaa, 0x94, 0x2c, 0x45, 0x02, 0xb3, 0xd9, 0xa9, 0x71, 0x35, 0x3a, 0x18, 0xbd, 0x94, 0xda, 
-  0xdf, 0x89, 0x23, 0x2a, 0xdd, 0x8e, 0xdf, 0xf1, 0xfc, 0x98, 0xc7, 0xae, 0xe7, 0x4b, 0xfe, 0x92, 
-  0x9f, 0x93, 0xe4, 0x09, 0x16, 0xc4, 0xc0, 0x32, 0x59, 0x5f, 0x30, 0x80, 0x8f, 0x3b, 0x72, 0x29, 
-  0x3b, 0x5d, 0xd4, 0x99, 0xc9, 0x79, 0xfa, 0x11, 0xc1, 0xe7, 0x47, 0xa1, 0xff, 0xe5, 0x0c, 0x3e, 
-  0x83, 0x38, 0x56, 0x1f, 0x42, 0x3d, 0x5d, 0xea, 0x26, 0x17, 0x58, 0x7f, 0x06, 0xe2, 0x0c, 0x3e, 
-  0xa6, 0xdf, 0x74, 0x4e, 0x2a, 0x53, 0xa5, 0xce, 0xd9, 0x52, 0x82, 0x29, 0x1d, 0x44, 0x8b, 0x90, 
-  0x08, 0x77, 0x29, 0x15, 0xc3, 0x01, 0xec, 0xa3, 0x11, 0x22, 0xb5, 0xc4, 0xb6, 0xe0, 0x84, 0xd7, 
-  0xe0, 0xe4, 0x3a, 0x28, 0x51, 0x08, 0x89, 0xd9, 0x54, 0xad, 0x3d, 0x4e, 0x3f, 0x88, 0xfa, 0x9c, 
-  0xd2, 0x09, 0x7c, 0xd0, 0x80, 0xc3, 0x87, 0x38, 0x53, 0x0f, 0xc7, 0xf3, 0xb8, 0x66, 0xd1, 0xeb, 
-  0x25, 0xcb, 0xf2, 0x8c, 0x97, 0x2d, 0x89, 0x2f, 0xcc, 0x1c, 0x97, 0xe7, 0xba, 0x94, 0xa7, 0x16, 
-  0x91, 0x63, 0x52, 0x0e, 0xa4, 0xb0, 0x93, 0x4a, 0x53, 0x93, 0xcc, 0x0f, 0x4d, 0x07, 0x8a, 0xa8, 
-  0x71, 0x20, 0x59, 0x18, 0x08, 0x9b, 0xb4, 0x04, 0x2e, 0xee, 0xee, 0x2a, 0xc6, 0x75, 0xf0, 0x87, 
-  0x7f, 0xf9, 0x35, 0x18, 0x62, 0xef, 0x94, 0x86, 0xed, 0xbf, 0xe2, 0x67, 0xa4, 0x26, 0x5e, 0x85, 
-  0x4d, 0xc2, 0x2c, 0x8d, 0xcb, 0x57, 0x54, 0xcb, 0x72, 0x31, 0xc5, 0xa4, 0x88, 0x69, 0x71, 0x71, 
-  0xc2, 0xe7, 0xb1, 0x74, 0x1d, 0x0d, 0x87, 0x8a, 0xf4, 0x30, 0x15, 0x9b, 0x94, 0xdc, 0x01, 0x0c, 
-  0x5b, 0xba, 0x43, 0xd4, 0x09, 0x02, 0x62, 0x18, 0x36, 0x44, 0x0c, 0xdf, 0x18, 0x7c, 0x8b, 0x5d, 
-  0xd6, 0x45, 0xd8, 0x10, 0x75, 0xbf, 0xac, 0x3e, 0x32, 0x2d, 0xb3, 0x88, 0xed, 0xee, 0x0d, 0x62, 
-  0xfb, 0xf7, 0x7f, 0x07, 0xd8, 0x7e, 0xca, 0xcf, 0x55, 0x3c, 0xfc, 0xe6, 0x50, 0xad, 0xf0, 0xd8, 
-  0x45, 0x74, 0xaf, 0x99, 0x12, 0x5d, 0x73, 0x13, 0x6c, 0x89, 0x3b, 0x2a, 0x3b, 0x92, 0x1a, 0xa3, 
-  0xfc, 0x5e, 0x21, 0x4a, 0x88, 0x4d, 0xd1, 0xc1, 0xb5, 0x49, 0xb8, 0x0a, 0xdb, 0xa5, 0x61, 0x85, 
-  0x71, 0xc4, 0xc7, 0x8e, 0xb5, 0x75, 0xcb, 0x7c, 0x81, 0x29, 0x13, 0xf1, 0x38, 0xe2, 0x63, 0xf7, 
-  0x78, 0x3d, 0xe1, 0x49, 0xb7, 0xa6, 0xa3, 0x22, 0xe6, 0x45, 0x4c, 0x86, 0xc8, 0x81, 0x33, 0x39, 
-  0x34, 0x50, 0xe6, 0x76, 0x9f, 0x07, 0x92, 0x48, 0x21, 0x13, 0x82, 0xe7, 0x8e, 0xbd, 0xf3, 0xa5, 
-  0x57, 0x37, 0x70, 0x57, 0x25, 0x89, 0xdc, 0x73, 0xca, 0x42, 0x7e, 0xee, 0x7f, 0x78, 0xf7, 0x12, 
-  0xb4, 0x6a, 0xfa, 0x3f, 0x5d, 0x7f, 0xff, 0xe1, 0xdd, 0x4b, 0x2f, 0x4d, 0xf0, 0xbd, 0x19, 0x7f, 
-  0x24, 0x01, 0x3c, 0x30, 0x04, 0x9b, 0x8a, 0x83, 0x82, 0x4e, 0xb1, 0x64, 0x07, 0xc1, 0x0d, 0xdb, 
-  0xb3, 0xf7, 0x96, 0xbe, 0x20, 0xf2, 0x91, 0x94, 0x09, 0x1d, 0x2f, 0x24, 0x71, 0x9d, 0x30, 0xe5, 
-  0x42, 0xa0, 0x9d, 0x9f, 0x90, 0x38, 0xc2, 0x01, 0x71, 0xfb, 0x5f, 0xfb, 0x5f, 0x1e, 0xff, 0xec, 
-  0x67, 0xfd, 0x93, 0x7e, 0x17, 0x39, 0x8e, 0x67, 0xa3, 0xa7, 0x69, 0x3c, 0x70, 0xd8, 0x94, 0xb0, 
-  0xd6, 0xf4, 0x29, 0x66, 0xfb, 0x8a, 0xba, 0xaf, 0x76, 0x2a, 0x25, 0x0b, 0x6e, 0xfb, 0xa1, 0xf3, 
-  0x29, 0x59, 0x69, 0x41, 0xe9, 0xa5, 0xf9, 0xb1, 0x95, 0x29, 0x55, 0xa0, 0xfb, 0xca, 0x5a, 0x85, 
-  0xbb, 0x4c, 0x07, 0x82, 0x3f, 0x9d, 0x7a, 0xf9, 0xe3, 0xef, 0x7e, 0xf3, 0x4b, 0xd0, 0x2f, 0x3f, 
-  0x82, 0xc2, 0x47, 0x2c, 0x54, 0xc9, 0xc1, 0xa7, 0x51, 0xe7, 0x36, 0x25, 0x22, 0x25, 0x99, 0xc7, 
-  0x2a, 0x05, 0xfd, 0x48, 0x40, 0x80, 0xde, 0x65, 0xed, 0xf0, 0xe5, 0x5d, 0x49, 0x0d, 0xe3, 0xd4, 
-  0x59, 0x4e, 0x8f, 0x37, 0x3c, 0x3b, 0x83, 0x10, 0xbf, 0xcd, 0x57, 0x2e, 0x74, 0xd0, 0xe5, 0x72, 
-  0xd0, 0x74, 0xe0, 0xdc, 0x0c, 0x01, 0x66, 0xe6, 0x24, 0xd8, 0xa7, 0x24, 0xf6, 0x3f, 0xff, 0x46, 
-  0x6d, 0x26, 0x24, 0x22, 0x92, 0xfc, 0x49, 0xc9, 0xbc, 0xca, 0x87, 0xe8, 0xb9, 0x75, 0xb1, 0xf7, 
-  0x6a, 0xcf, 0x3e, 0xd4, 0x09, 0x8f, 0x45, 0x1b, 0xda, 0x5f, 0x5a, 0x0c, 0xab, 0xc8, 0x1a, 0x96, 
-  0x37, 0x98, 0x44, 0xca, 0x5e, 0x37, 0x41, 0xaa, 0xc3, 0xf4, 0xa5, 0x0a, 0x83, 0x20, 0xe1, 0x51, 
-  0xf4, 0x9e, 0xc7, 0xa0, 0x8e, 0x57, 0xaf, 0xb2, 0x2f, 0xa9, 0x2a, 0x5d, 0xb7, 0x32, 0x0f, 0xcb, 
-  0x2d, 0xc3, 0xaa, 0x08, 0x50, 0xf3, 0xb8, 0xd0, 0xcc, 0x3c, 0x70, 0xa4, 0xac, 0xe3, 0x20, 0xa2, 
-  0x84, 0xc9, 0x9f, 0x40, 0x6c, 0xc2, 0xdc, 0x2c, 0xcc, 0x35, 0xfb, 0x29, 0xda, 0x36, 0xee, 0xfb, 
-  0x58, 0x97, 0x60, 0xbc, 0x4e, 0x03, 0xf5, 0xf9, 0x3a, 0x96, 0x1a, 0xc9, 0xc8, 0x85, 0x65, 0x55, 
-  0xd5, 0x58, 0x5d, 0xdb, 0x48, 0xc7, 0xbb, 0x22, 0x20, 0x7a, 0x35, 0xe2, 0x95, 0x6f, 0x29, 0x39, 
-  0x04, 0x36, 0x43, 0x7b, 0x43, 0x17, 0xdc, 0x63, 0x81, 0x86, 0x39, 0x1f, 0xd1, 0x66, 0x58, 0xb7, 
-  0x37, 0xae, 0x5b, 0x1a, 0xd8, 0xd9, 0x80, 0x54, 0xf9, 0x88, 0xcc, 0xf3, 0x03, 0x68, 0xfb, 0x9a, 
-  0x87, 0x3a, 0xc2, 0x94, 0x1e, 0x40, 0xb1, 0x6d, 0x3c, 0xdd, 0x16, 0xc6, 0x79, 0x4b, 0x31, 0x57, 
-  0xbb, 0x0c, 0x54, 0x1b, 0x98, 0x6d, 0xc7, 0x7f, 0xfb, 0x2d, 0x7a, 0xc2, 0xa3, 0x08, 0xc7, 0xa2, 
-  0x4e, 0xda, 0xaf, 0x20, 0xf1, 0x2d, 0xa5, 0x5e, 0xa7, 0x0a, 0x6d, 0xf8, 0x51, 0x79, 0xac, 0x1b, 
-  0xd9, 0x67, 0x1b, 0x35, 0x66, 0x15, 0x9d, 0xd4, 0x6e, 0x77, 0x1a, 0x35, 0xe7, 0x3f, 0x7e, 0x87, 
-  0xde, 0xe9, 0xd2, 0x96, 0x06, 0x4c, 0xd2, 0x4f, 0x86, 0xc9, 0xc4, 0x55, 0xea, 0x6d, 0x23, 0x8c, 
-  0xa9, 0xe0, 0x90, 0x85, 0x39, 0xfe, 0x09, 0x3d, 0x5b, 0xc6, 0x98, 0x85, 0x7f, 0xa6, 0xac, 0x31, 
-  0xb8, 0x69, 0x54, 0xd4, 0xb9, 0x31, 0x1b, 0x72, 0x8f, 0x55, 0x18, 0xaf, 0xef, 0x31, 0xdf, 0x00, 
-  0xca, 0xf7, 0xea, 0xdd, 0x9e, 0x6b, 0x78, 0xcf, 0x57, 0xf1, 0xa0, 0x37, 0x97, 0xe7, 0x4f, 0x4f, 
-  0x91, 0xd6, 0x96, 0xd0, 0xa7, 0x15, 0x80, 0x8a, 0x55, 0xa4, 0x83, 0xbc, 0xed, 0xec, 0x22, 0x0b, 
-  0x5e, 0x4d, 0xa6, 0xb2, 0x8b, 0x2d, 0x4e, 0x96, 0xdd, 0xb9, 0xc2, 0xb6, 0xc0, 0x12, 0xe4, 0x50, 
-  0xb1, 0xcf, 0x27, 0x13, 0x41, 0xe4, 0x8f, 0xa1, 0xfa, 0xd8, 0x6c, 0x6f, 0xcc, 0x72, 0xcd, 0xbe, 
-  0x52, 0x85, 0x4e, 0x7b, 0x66, 0x3b, 0x73, 0xce, 0x17, 0x82, 0xf0, 0x85, 0x6c, 0x8e, 0xf6, 0xea, 
-  0x14, 0xe2, 0xca, 0xd4, 0xd9, 0x47, 0x11, 0x18, 0x4e, 0xeb, 0x07, 0x07, 0xca, 0xae, 0x08, 0xf2, 
-  0x0f, 0x7f, 0x8a, 0xf6, 0x51, 0x58, 0x7c, 0x70, 0xa0, 0x8c, 0x8a, 0x99, 0x42, 0xec, 0x9a, 0x4c, 
-  0xf8, 0xea, 0x86, 0x67, 0x68, 0x37, 0x3c, 0xd2, 0xb8, 0x61, 0x73, 0x44, 0x42, 0x59, 0x27, 0x16, 
-  0x99, 0xcb, 0x15, 0xe8, 0x56, 0x4b, 0x7f, 0x36, 0xaa, 0x75, 0x64, 0x60, 0x29, 0x48, 0x43, 0x6a, 
-  0xca, 0xea, 0x80, 0x17, 0x6b, 0xa7, 0x00, 0x65, 0xa5, 0x27, 0x5b, 0x90, 0xa6, 0xb8, 0x73, 0x27, 
-  0xab, 0x17, 0x7d, 0x8b, 0xe5, 0xac, 0x5c, 0x38, 0x69, 0x19, 0x3a, 0xdf, 0x43, 0xb6, 0xf0, 0x0e, 
-  0x5d, 0xa6, 0xaa, 0xed, 0xae, 0x3c, 0x51, 0x56, 0xca, 0x7a, 0x65, 0x3a, 0x27, 0x0d, 0x91, 0x5b, 
-  0x15, 0xcf, 0x12, 0x06, 0x22, 0xe6, 0x09, 0x38, 0xe8, 0x22, 0x07, 0x4a, 0x9c, 0xc1, 0x95, 0x54, 
-  0x55, 0x98, 0xaa, 0xa2, 0xb4, 0xe3, 0xfb, 0xbe, 0x51, 0xcf, 0xb9, 0xcb, 0x79, 0x04, 0x44, 0xb4, 
-  0x05, 0xd3, 0xb2, 0x98, 0x97, 0xa2, 0x6a, 0xda, 0xd6, 0xe2, 0x52, 0x9a, 0x72, 0x9e, 0xc2, 0x12, 
-  0xc1, 0x6b, 0xc7, 0xb0, 0x80, 0x8e, 0x1b, 0xe0, 0x59, 0x69, 0xe3, 0x59, 0xa9, 0x8c, 0x97, 0x2d, 
-  0x55, 0x35, 0x70, 0xdb, 0xc5, 0x9e, 0xce, 0x6a, 0x31, 0xe5, 0xc8, 0x40, 0xf9, 0x56, 0xea, 0x21, 
-  0x29, 0x7d, 0xa5, 0xc4, 0xd9, 0xf9, 0xf0, 0x12, 0x32, 0x67, 0x88, 0xf9, 0x12, 0x4f, 0x95, 0x17, 
-  0x93, 0x32, 0xec, 0x3a, 0xb0, 0x63, 0xe5, 0xf4, 0x76, 0x5e, 0x84, 0x4e, 0x9d, 0x09, 0x9e, 0x48, 
-  0xb7, 0x7d, 0x87, 0x62, 0xb5, 0xb6, 0x0a, 0x66, 0x2a, 0x18, 0xe1, 0x1b, 0xd4, 0xaa, 0xc1, 0x0e, 
-  0xec, 0x47, 0x3c, 0xc0, 0x11, 0x79, 0xc2, 0xe7, 0x70, 0xde, 0xc4, 0x65, 0xea, 0xa1, 0xaa, 0x5c, 
-  0x53, 0xed, 0x2a, 0xaf, 0xe1, 0xa1, 0x57, 0x17, 0x67, 0x6c, 0xb0, 0x01, 0xda, 0xb9, 0x42, 0xda, 
-  0x48, 0x23, 0x5e, 0x3b, 0x8f, 0xa8, 0x50, 0xee, 0xae, 0xf6, 0xf0, 0x34, 0xf7, 0xdc, 0x55, 0x8c, 
-  0x36, 0xd8, 0x43, 0x02, 0xed, 0x23, 0xbc, 0x87, 0xc4, 0xf6, 0x76, 0x23, 0xc2, 0xb2, 0x62, 0x25, 
-  0x5d, 0x0b, 0xa7, 0x12, 0x4b, 0xae, 0x2a, 0x5e, 0x3a, 0x16, 0x27, 0x5e, 0x86, 0xbb, 0x02, 0x0d, 
-  0x6c, 0xae, 0xff, 0xd5, 0xb2, 0x23, 0x16, 0x02, 0x62, 0x5d, 0x0d, 0x01, 0x49, 0x56, 0xa0, 0xa2, 
-  0x3a, 0x6d, 0xe0, 0xa8, 0x02, 0xc3, 0x75, 0x5a, 0xbf, 0xdb, 0x3c, 0x1a, 0x29, 0x57, 0x59, 0xb4, 
-  0xe8, 0x43, 0x21, 0x1a, 0x78, 0xa8, 0x76, 0xb2, 0xc2, 0x69, 0x0a, 0xb9, 0x94, 0x2a, 0x07, 0x9c, 
-  0x45, 0x0b, 0x2b, 0x0d, 0xe8, 0x7c, 0xda, 0x6a, 0x02, 0x52, 0x3a, 0xda, 0x01, 0xe6, 0xe0, 0x3e, 
-  0x3d, 0x70, 0x2b, 0x45, 0xde, 0x52, 0x2d, 0xd6, 0xdb, 0xef, 0x53, 0xab, 0xcd, 0x64, 0xaf, 0xfd, 
-  0x20, 0x5e, 0xab, 0x2e, 0xad, 0x73, 0xc0, 0x4d, 0xdb, 0x06, 0x50, 0xcc, 0x6b, 0xee, 0x76, 0xd9, 
-  0xdc, 0xa4, 0x2d, 0xdc, 0x3a, 0x6c, 0x32, 0x6f, 0x3c, 0x51, 0x64, 0xa7, 0x03, 0x24, 0x9d, 0x09, 
-  0x93, 0x69, 0x8d, 0x92, 0xdb, 0x06, 0x63, 0x59, 0x25, 0x10, 0x8f, 0xdf, 0x26, 0x3c, 0xc6, 0x53, 
-  0xac, 0xf5, 0x77, 0xcb, 0x9e, 0x2a, 0x78, 0x06, 0x98, 0xea, 0x16, 0x8b, 0x89, 0x3f, 0x31, 0xb6, 
-  0xea, 0x9b, 0x5c, 0x02, 0x50, 0xa1, 0xae, 0xd7, 0x41, 0xa1, 0x0f, 0xc7, 0x36, 0xbd, 0x72, 0xbc, 
-  0xe7, 0xd3, 0x0a, 0x7d, 0x1b, 0x69, 0xdf, 0x6b, 0x37, 0x79, 0x63, 0xf5, 0x6f, 0x8d, 0xd2, 0x59, 
-  0x17, 0x06, 0x2b, 0xf7, 0x78, 0xcc, 0x97, 0x6d, 0xc4, 0xee, 0x8c, 0xd3, 0x30, 0x2d, 0x05, 0x52, 
-  0x26, 0x9a, 0xfa, 0xc7, 0xa5, 0xf9, 0x02, 0x3e, 0x27, 0xfb, 0xee, 0x78, 0x1b, 0xcb, 0x31, 0x6d, 
-  0xd3, 0xc5, 0xcd, 0xed, 0x33, 0xea, 0x3a, 0x16, 0xa8, 0x27, 0x03, 0xe9, 0x48, 0xab, 0xeb, 0x6b, 
-  0x32, 0x88, 0xf6, 0x99, 0x65, 0x2b, 0x6d, 0xb9, 0x41, 0x45, 0x99, 0xb9, 0x7f, 0x16, 0x8a, 0x00, 
-  0xeb, 0xf6, 0x4f, 0xab, 0x45, 0xe4, 0xf5, 0xb4, 0xdf, 0x1a, 0xf4, 0xc3, 0xdc, 0x77, 0x08, 0xb6, 
-  0x81, 0x3d, 0x45, 0xdb, 0xc6, 0x58, 0x8a, 0xf1, 0x16, 0x85, 0x80, 0xff, 0xd7, 0xa3, 0x1b, 0xe8, 
-  0xd1, 0x9d, 0x3f, 0x43, 0x3d, 0xda, 0xa4, 0x74, 0x64, 0xa9, 0xa4, 0xbb, 0xc6, 0xc2, 0xac, 0xb3, 
-  0x18, 0x73, 0x87, 0x04, 0xbc, 0x55, 0x3d, 0x24, 0xb1, 0x84, 0x30, 0x20, 0x38, 0x91, 0x3b, 0x76, 
-  0x27, 0x4b, 0xc7, 0xee, 0x2c, 0xeb, 0xcf, 0x69, 0x37, 0xf0, 0x0d, 0x2c, 0x61, 0x44, 0x7d, 0xd4, 
-  0x09, 0xd7, 0x45, 0x19, 0x6d, 0x13, 0xa8, 0x53, 0x67, 0xf9, 0xea, 0xc9, 0xc0, 0x15, 0xde, 0xd5, 
-  0x53, 0x93, 0xa9, 0x73, 0x56, 0x3a, 0x25, 0x05, 0x37, 0x0c, 0x1e, 0x86, 0x34, 0x19, 0x29, 0x57, 
-  0xd0, 0x56, 0x0e, 0x91, 0xf5, 0x35, 0x1d, 0x9b, 0xaa, 0xf3, 0x58, 0x83, 0xba, 0x0a, 0x5a, 0xe5, 
-  0x46, 0xa9, 0x4a, 0x2a, 0x03, 0x4f, 0x30, 0xad, 0xf5, 0x58, 0x17, 0x91, 0x96, 0x73, 0xc5, 0x76, 
-  0x3f, 0xa8, 0xec, 0xff, 0xaa, 0x98, 0x63, 0xc9, 0x01, 0x86, 0xf3, 0x51, 0x9d, 0x55, 0xdc, 0xcb, 
-  0xea, 0x0f, 0x33, 0x63, 0x79, 0x2e, 0x5b, 0x15, 0xe6, 0xb2, 0xeb, 0x38, 0xd1, 0x61, 0xd6, 0xd0, 
-  0x12, 0x00, 0xcd, 0xf9, 0x4d, 0xe8, 0x39, 0x4f, 0xe6, 0x4f, 0xb1, 0xc4, 0x35, 0x75, 0x55, 0x6e, 
-  0x7a, 0xd2, 0xc5, 0x0c, 0xd4, 0xba, 0x95, 0x48, 0x02, 0x07, 0xf0, 0xdc, 0xc8, 0x34, 0x6f, 0x3f, 
-  0x68, 0xa6, 0x81, 0xc3, 0x12, 0x4e, 0x23, 0x9f, 0xc8, 0x96, 0x84, 0x5b, 0x58, 0x98, 0xa4, 0x4c, 
-  0x35, 0x15, 0xa2, 0xbc, 0xe1, 0xb0, 0x45, 0x0e, 0xe3, 0xc4, 0x86, 0x71, 0xd6, 0x8c, 0x71, 0x56, 
-  0xc6, 0x78, 0x0b, 0x64, 0x3e, 0x7d, 0xf6, 0xf2, 0xd9, 0xfb, 0x67, 0x1b, 0xe0, 0xb3, 0xa1, 0x5a, 
-  0x7b, 0xe5, 0x1f, 0x16, 0x53, 0xa8, 0xb9, 0xeb, 0xd1, 0xaa, 0x25, 0xf1, 0xba, 0xb0, 0xbe, 0x72, 
-  0xd2, 0xa9, 0xe2, 0x71, 0x57, 0x62, 0xdb, 0x72, 0x46, 0x85, 0x1f, 0x44, 0x04, 0x27, 0xaf, 0x30, 
-  0x65, 0x6f, 0x31, 0x53, 0xc7, 0x0f, 0xea, 0xa3, 0x36, 0xb7, 0xdd, 0xf4, 0x94, 0x8d, 0xe9, 0xc8, 
-  0xa7, 0xad, 0xfa, 0x61, 0xd5, 0x29, 0x3b, 0x9a, 0xb3, 0x41, 0x5f, 0xb9, 0x41, 0x7e, 0x58, 0x96, 
-  0x82, 0xf4, 0x21, 0x3d, 0xcb, 0xce, 0xd2, 0xe6, 0x6e, 0x3b, 0xd2, 0x97, 0x1d, 0x75, 0x0e, 0x5c, 
-  0x55, 0x3d, 0x00, 0x55, 0xdd, 0x13, 0x38, 0x63, 0x8b, 0x78, 0x02, 0x71, 0x87, 0x39, 0xd6, 0x95, 
-  0xde, 0xab, 0x53, 0xbb, 0xde, 0x7e, 0x3f, 0xa4, 0x67, 0x07, 0xce, 0x26, 0xc5, 0xc7, 0x0a, 0xb3, 
-  0x39, 0xf7, 0xb1, 0x5d, 0x55, 0x37, 0x04, 0xfe, 0xba, 0x28, 0xda, 0x33, 0x22, 0xd0, 0xb8, 0x17, 
-  0x1a, 0x70, 0x60, 0x3c, 0x7a, 0xaa, 0x4c, 0x76, 0x98, 0xf9, 0x10, 0x39, 0x70, 0x31, 0xe9, 0x84, 
-  0x32, 0x12, 0x2a, 0x67, 0x04, 0x5c, 0x02, 0x3e, 0x41, 0x38, 0x20, 0x2a, 0xff, 0x6b, 0x19, 0xd4, 
-  0x32, 0x3f, 0xee, 0xfe, 0x85, 0x33, 0x48, 0xfe, 0xb4, 0xf5, 0xfa, 0x88, 0x75, 0xe7, 0x00, 0x8e, 
-  0x07, 0x69, 0x80, 0x50, 0xc0, 0x17, 0x51, 0xa8, 0x38, 0x42, 0x9d, 0xb2, 0xc5, 0x21, 0x9c, 0xf6, 
-  0x4e, 0xf8, 0x1c, 0xc9, 0x19, 0x41, 0xaa, 0xfa, 0x87, 0x11, 0xe0, 0x98, 0x44, 0x3f, 0x55, 0x6a, 
-  0x40, 0xdd, 0x5d, 0xf2, 0x51, 0x20, 0x3f, 0xbb, 0xa1, 0x11, 0x14, 0x9e, 0xe4, 0xaa, 0x2c, 0x0a, 
-  0x81, 0x10, 0x93, 0xc4, 0xf7, 0xfd, 0xec, 0x14, 0x78, 0x9c, 0x10, 0x75, 0x12, 0x5d, 0xae, 0xfc, 
-  0x19, 0xd1, 0xc9, 0x80, 0x5a, 0x5f, 0xed, 0xa2, 0xae, 0x70, 0xec, 0x1c, 0xec, 0xf7, 0xe3, 0x84, 
-  0x18, 0xe3, 0x25, 0xae, 0x68, 0xd2, 0x93, 0xcd, 0xf1, 0xd8, 0xdb, 0x2a, 0x0e, 0x94, 0x41, 0xe1, 
-  0x94, 0x9d, 0x2c, 0xc5, 0xd6, 0x79, 0xbb, 0xea, 0xaa, 0x25, 0x69, 0xa2, 0x58, 0xc0, 0xe9, 0x19, 
-  0x9b, 0xe8, 0xaa, 0x37, 0x7d, 0xb0, 0x02, 0x56, 0xf0, 0x21, 0x89, 0x74, 0x02, 0x82, 0x6b, 0x4e, 
-  0x76, 0xa3, 0xcd, 0xb8, 0x35, 0xfa, 0x4b, 0xe7, 0x56, 0x3a, 0x9f, 0xaa, 0xcb, 0x75, 0xd4, 0xd6, 
-  0x19, 0x69, 0x83, 0x27, 0xe5, 0x93, 0x39, 0x5e, 0xa6, 0xb7, 0x97, 0xab, 0x3b, 0xf1, 0xe0, 0xda, 
-  0x87, 0xec, 0x62, 0xd7, 0xec, 0x81, 0xba, 0xee, 0x53, 0x71, 0xd1, 0xea, 0x9a, 0x26, 0x7d, 0x3d, 
-  0x53, 0x07, 0xf5, 0x0f, 0x54, 0xe8, 0xaf, 0xb8, 0x15, 0xb8, 0x9b, 0x1d, 0xe7, 0x28, 0xab, 0x3c, 
-  0x5d, 0x86, 0xd7, 0xac, 0xf8, 0x6c, 0xaa, 0xcd, 0xa0, 0x05, 0xe1, 0x06, 0x95, 0x2d, 0x93, 0x7e, 
-  0xf3, 0xd2, 0x7d, 0xd3, 0xd0, 0xe7, 0x2a, 0x24, 0xdf, 0xbb, 0x06, 0xc9, 0xf7, 0x36, 0x20, 0x79, 
-  0x2b, 0x70, 0x61, 0xd1, 0x56, 0x9d, 0x6d, 0x15, 0xe4, 0x9b, 0x51, 0x74, 0x3e, 0x3a, 0x9a, 0xf1, 
-  0x73, 0xa5, 0xbc, 0x80, 0x96, 0xe9, 0xc5, 0xab, 0xd7, 0x54, 0x5d, 0x35, 0x85, 0x50, 0xa2, 0xcd, 
-  0x9d, 0x2e, 0x39, 0x1d, 0xb2, 0x59, 0xad, 0xf6, 0xf5, 0x95, 0x1b, 0x2a, 0xdd, 0x7e, 0x64, 0x57, 
-  0x69, 0x56, 0x17, 0x39, 0x53, 0x6b, 0x86, 0xd7, 0x97, 0x88, 0x44, 0x82, 0xd8, 0x56, 0x90, 0xd7, 
-  0x81, 0x7b, 0x9b, 0x66, 0x1f, 0x4d, 0xb2, 0x9a, 0x4b, 0x81, 0x36, 0x4b, 0xa9, 0xe2, 0xc2, 0xec, 
-  0x22, 0x90, 0x51, 0xe1, 0x22, 0x10, 0x8b, 0x77, 0x9f, 0x28, 0xc7, 0xca, 0x74, 0xf2, 0x04, 0x16, 
-  0x09, 0xe3, 0xf5, 0x76, 0x54, 0x34, 0xb4, 0xee, 0x0e, 0x85, 0xf6, 0x03, 0x5a, 0xb0, 0x56, 0xb8, 
-  0x37, 0xe9, 0xf8, 0x44, 0x57, 0xb1, 0x93, 0x3d, 0xd4, 0xdb, 0xd1, 0x39, 0xc3, 0xf2, 0xdc, 0x60, 
-  0x29, 0x6d, 0xdd, 0x86, 0xe4, 0x14, 0xf2, 0xea, 0x72, 0x77, 0xf1, 0x42, 0xcc, 0x1a, 0x2a, 0xc7, 
-  0x0d, 0x09, 0x72, 0x6b, 0xce, 0xcb, 0xd1, 0x72, 0x8d, 0x0e, 0xb3, 0xa1, 0x15, 0x2c, 0xc3, 0xc6, 
-  0x89, 0x82, 0x2b, 0x94, 0xba, 0x9a, 0x78, 0x61, 0x7d, 0xa0, 0xb3, 0xc0, 0x0a, 0x6d, 0x5d, 0x71, 
-  0xdd, 0x75, 0xe5, 0xd5, 0xfd, 0x5f, 0x72, 0xbe, 0xf5, 0x3d, 0x18, 0x2a, 0x49, 0xdd, 0xc2, 0xb5, 
-  0x7e, 0x73, 0x74, 0x83, 0xbe, 0xb5, 0x8d, 0x50, 0xfa, 0xb8, 0x65, 0xb3, 0xcc, 0x96, 0xa9, 0xa4, 
-  0xfa, 0xb5, 0x74, 0xbd, 0xcd, 0x07, 0x98, 0xd7, 0x47, 0x97, 0xc9, 0x5f, 0xa8, 0xbf, 0xbe, 0x59, 
-  0xf0, 0x63, 0xb3, 0xa3, 0xd5, 0x5a, 0x41, 0x19, 0xa8, 0xd6, 0xe6, 0x14, 0xa9, 0xbe, 0x8c, 0x20, 
-  0x4b, 0x46, 0xa9, 0x22, 0x10, 0x5a, 0xa1, 0x6a, 0xc3, 0x39, 0xc7, 0x35, 0xe6, 0x9c, 0x38, 0xc2, 
-  0x94, 0x39, 0xe6, 0x9a, 0x2a, 0xe0, 0xff, 0xbe, 0x7b, 0x38, 0xfc, 0x99, 0xef, 0x1e, 0x7f, 0xed, 
-  0x9f, 0x6c, 0x7b, 0xde, 0xe1, 0xed, 0xbe, 0x4f, 0x96, 0x04, 0x02, 0x7d, 0xc7, 0x3b, 0x27, 0x16, 
-  0xcb, 0x2b, 0x9f, 0x08, 0xb2, 0xe8, 0x46, 0x71, 0x4e, 0x65, 0x30, 0x43, 0x75, 0x35, 0xfe, 0x58, 
-  0x10, 0xa4, 0x72, 0xcd, 0xc3, 0x1a, 0xf5, 0xba, 0x5e, 0x41, 0x4d, 0xa0, 0x79, 0x9c, 0x10, 0x7c, 
-  0xba, 0x57, 0x37, 0xcd, 0x4c, 0xce, 0x1b, 0xa7, 0x81, 0x73, 0xad, 0xd7, 0x9b, 0xe5, 0xa3, 0x68, 
-  0x9c, 0xe4, 0x23, 0x3e, 0xc3, 0xfa, 0xb2, 0xca, 0xeb, 0x4d, 0x15, 0x08, 0xeb, 0x5c, 0xba, 0x81, 
-  0x68, 0x6c, 0x11, 0xcf, 0xe2, 0xfa, 0x06, 0x0a, 0x21, 0xc3, 0xfa, 0x05, 0x73, 0x56, 0xdf, 0x62, 
-  0xd9, 0x34, 0x04, 0x1c, 0x11, 0xae, 0x6f, 0x11, 0x88, 0xb3, 0x26, 0xb4, 0xca, 0xd6, 0xc5, 0x8c, 
-  0x69, 0x54, 0x8d, 0xd5, 0x4a, 0x73, 0xca, 0xdf, 0x50, 0x22, 0xc2, 0x56, 0x17, 0x3e, 0x38, 0x7d, 
-  0x75, 0x59, 0xb3, 0x0f, 0xac, 0x54, 0x16, 0xed, 0x5c, 0x07, 0x9d, 0x14, 0x55, 0xa7, 0xf2, 0xa1, 
-  0xc0, 0xcc, 0xde, 0x10, 0xaf, 0x0e, 0x62, 0xa9, 0xeb, 0x8d, 0xe6, 0x58, 0x92, 0xba, 0x71, 0xa9, 
-  0x8e, 0xdc, 0xa8, 0x18, 0xe0, 0x5f, 0x07, 0x71, 0xbc, 0x3e, 0xd1, 0xaf, 0xba, 0xf7, 0xb5, 0x90, 
-  0xc0, 0x1d, 0x56, 0xea, 0xbf, 0xea, 0x76, 0x3c, 0xeb, 0x95, 0x46, 0x8b, 0x28, 0xaa, 0x9e, 0x3e, 
-  0x07, 0x1f, 0x1a, 0xa2, 0x15, 0xa0, 0x10, 0xab, 0x96, 0x65, 0xae, 0x3a, 0xb1, 0x71, 0x8b, 0x31, 
-  0x16, 0x68, 0xa5, 0xc5, 0x59, 0x22, 0x2b, 0xce, 0x82, 0x64, 0x48, 0xa1, 0x3a, 0x4b, 0x18, 0xa3, 
-  0xda, 0x09, 0x21, 0x79, 0xfb, 0xd4, 0xad, 0x56, 0x1a, 0x9a, 0xba, 0xd5, 0x96, 0xe8, 0xd9, 0xeb, 
-  0xf1, 0xae, 0xb6, 0xb2, 0xfc, 0xa1, 0xfe, 0x2b, 0x84, 0x0e, 0x4c, 0x9d, 0xac, 0x81, 0x80, 0x36, 
-  0xde, 0x67, 0x7a, 0xdd, 0x9e, 0x85, 0x06, 0xa3, 0x1c, 0x0d, 0x20, 0x72, 0x02, 0x27, 0x28, 0xd5, 
-  0x25, 0x59, 0xae, 0x68, 0xac, 0x7e, 0x8c, 0x74, 0x8c, 0xf8, 0x48, 0xfd, 0x1c, 0x93, 0x2d, 0x8d, 
-  0x69, 0xbd, 0x64, 0x4e, 0xdd, 0xb0, 0x01, 0xf4, 0x2c, 0x47, 0x17, 0xae, 0x97, 0x7c, 0xaa, 0x54, 
-  0x43, 0xe6, 0x0d, 0xd0, 0x86, 0xb4, 0x42, 0x63, 0xa0, 0x2c, 0x69, 0x0c, 0x59, 0x59, 0x93, 0x6c, 
-  0xa2, 0x6d, 0x7a, 0x2d, 0xd5, 0x49, 0xe9, 0x3e, 0xb7, 0xae, 0xaf, 0x88, 0xe0, 0x42, 0xe0, 0x23, 
-  0x22, 0x84, 0xc2, 0x34, 0xd0, 0xe9, 0x15, 0x0f, 0x89, 0x0b, 0xd7, 0x1b, 0xf5, 0xe7, 0x3c, 0x24, 
-  0xa9, 0x90, 0x57, 0xef, 0x00, 0x23, 0xf2, 0xfd, 0x8c, 0xcc, 0xd3, 0x96, 0x12, 0xbe, 0xaa, 0xa6, 
-  0xb8, 0xda, 0xf4, 0xb6, 0x62, 0xb4, 0x23, 0x75, 0x22, 0x4c, 0x1f, 0x46, 0xdc, 0x41, 0x7d, 0x34, 
-  0xa8, 0xb4, 0x2b, 0x03, 0xf2, 0x41, 0x90, 0x23, 0x3e, 0x91, 0xef, 0xf1, 0x58, 0xb8, 0xd5, 0xd5, 
-  0x57, 0xdb, 0xbf, 0xc7, 0x63, 0x55, 0xe8, 0xb5, 0x6b, 0x84, 0xf6, 0x2b, 0x3a, 0x9d, 0x45, 0x10, 
-  0xa1, 0x7a, 0x14, 0xc0, 0x25, 0xe0, 0x2f, 0x29, 0x23, 0xc6, 0x51, 0x05, 0x91, 0x10, 0x85, 0x78, 
-  0x9b, 0x50, 0x26, 0x5f, 0xa9, 0x28, 0x96, 0x41, 0x22, 0x23, 0xb8, 0x9e, 0x69, 0x8e, 0x59, 0x28, 
-  0xa0, 0x58, 0xed, 0x89, 0xfe, 0xee, 0x1a, 0xf8, 0x06, 0xd2, 0xd7, 0x43, 0x7d, 0x31, 0x97, 0x49, 
-  0x56, 0xc6, 0x94, 0x85, 0x3f, 0x24, 0x17, 0x43, 0x9b, 0xfd, 0x72, 0x0e, 0x3f, 0x99, 0xe3, 0x3c, 
-  0x91, 0x49, 0xd4, 0x3b, 0xb2, 0x55, 0xcf, 0xcc, 0x71, 0x00, 0x6d, 0x34, 0x0c, 0xbd, 0x23, 0x83, 
-  0x15, 0x76, 0x69, 0x12, 0xa0, 0x25, 0x09, 0x86, 0x6d, 0xea, 0x13, 0x88, 0xf1, 0x32, 0x14, 0xdb, 
-  0xb0, 0x50, 0x71, 0xf7, 0x86, 0xc1, 0x6f, 0x3f, 0x96, 0x0f, 0x49, 0x5d, 0x9a, 0x50, 0xad, 0xa8, 
-  0xe7, 0x73, 0xe6, 0x3a, 0xba, 0xea, 0xc5, 0xe9, 0x36, 0x81, 0x64, 0x11, 0xfc, 0xca, 0x6d, 0xf5, 
-  0xd5, 0xd9, 0xd2, 0x78, 0xc6, 0xd5, 0x43, 0x84, 0x9b, 0xa8, 0x21, 0x43, 0x5b, 0x9a, 0xed, 0xc2, 
-  0xfd, 0xd5, 0x3d, 0xb6, 0x5c, 0xd7, 0x05, 0x1b, 0x77, 0x97, 0x1b, 0x92, 0x54, 0xb3, 0xdb, 0xde, 
-  0x74, 0x3b, 0x10, 0x90, 0xbc, 0xd5, 0x25, 0xc6, 0x24, 0xf3, 0x1e, 0xf8, 0xde, 0xf5, 0xb0, 0x43, 
-  0x2c, 0x45, 0x55, 0xea, 0xe0, 0x25, 0xac, 0x5c, 0x6f, 0x1f, 0xaa, 0x84, 0xcd, 0x76, 0xfe, 0x98, 
-  0x76, 0x9b, 0x15, 0xf7, 0x11, 0x3e, 0xbb, 0x31, 0xbd, 0x1d, 0x9a, 0x7a, 0xf1, 0x92, 0x27, 0xe9, 
-  0x95, 0x7d, 0xfb, 0xf5, 0xdd, 0x0d, 0xd2, 0x7a, 0x65, 0x83, 0xbe, 0xaa, 0xc1, 0x50, 0x21, 0x73, 
-  0xe9, 0x59, 0xfc, 0x4e, 0xd1, 0x3a, 0x26, 0x90, 0x6e, 0x19, 0x7c, 0x43, 0x96, 0x48, 0xef, 0x2c, 
-  0x6a, 0xe4, 0x8a, 0x95, 0xa0, 0x99, 0xab, 0xd6, 0xad, 0x3c, 0xb1, 0xd1, 0x5d, 0x4e, 0xd5, 0xb1, 
-  0xa3, 0x7a, 0xaf, 0x97, 0xb3, 0xc7, 0x3c, 0xbc, 0x50, 0xa5, 0xb5, 0xc6, 0x7b, 0x93, 0x88, 0xbe, 
-  0xc5, 0xe2, 0x17, 0x97, 0x95, 0x5f, 0x2a, 0x50, 0xf7, 0x58, 0x40, 0x21, 0x3b, 0x8c, 0xa3, 0x2e, 
-  0xeb, 0x5b, 0xdf, 0x21, 0x71, 0x7c, 0x78, 0xe7, 0x64, 0xdb, 0x3d, 0xfe, 0x7a, 0x74, 0xe7, 0x64, 
-  0xdb, 0x1b, 0xb9, 0xc7, 0x5f, 0xdf, 0x39, 0xf9, 0xd2, 0xeb, 0x4f, 0x69, 0xb7, 0x10, 0xd4, 0x02, 
-  0x01, 0x31, 0xa2, 0x8a, 0x1d, 0xcb, 0x13, 0xb0, 0x87, 0x1b, 0x54, 0x57, 0x3e, 0x1c, 0xbf, 0x55, 
-  0x48, 0xa1, 0xaa, 0xeb, 0x76, 0xd1, 0xa8, 0xe8, 0xd3, 0x67, 0x16, 0x5f, 0x17, 0x31, 0x75, 0x59, 
-  0x1a, 0x7c, 0xc2, 0x0f, 0x5c, 0xc3, 0xa7, 0xda, 0xa7, 0x2b, 0xea, 0xa6, 0x70, 0x4d, 0xac, 0xa3, 
-  0x7f, 0xad, 0xcc, 0xe9, 0x2a, 0x33, 0x6a, 0x35, 0xb8, 0xba, 0x76, 0xca, 0x81, 0x47, 0x3a, 0xf2, 
-  0x51, 0xe5, 0x42, 0xab, 0x39, 0x6c, 0xfc, 0xfd, 0x5c, 0xe5, 0x26, 0x28, 0x1f, 0x35, 0x87, 0x71, 
-  0x7b, 0xb2, 0x18, 0x56, 0x0a, 0x97, 0x23, 0x71, 0x38, 0x8e, 0xcd, 0xa7, 0xae, 0xf3, 0x04, 0x33, 
-  0xc8, 0x1d, 0x28, 0x49, 0x4c, 0xd3, 0x9f, 0xab, 0x34, 0xe9, 0x39, 0x19, 0x03, 0xf4, 0x17, 0x20, 
-  0xe8, 0xea, 0x08, 0x02, 0x0a, 0x78, 0x7c, 0x51, 0x10, 0x06, 0x37, 0xfd, 0xf1, 0x88, 0x75, 0x41, 
-  0xbb, 0xf6, 0x97, 0x3d, 0xcf, 0x17, 0x49, 0xa0, 0x3c, 0xb1, 0x5c, 0x66, 0x35, 0xaf, 0x70, 0x74, 
-  0x43, 0x1f, 0x8b, 0x0b, 0x16, 0x94, 0xef, 0xb4, 0x5d, 0x1d, 0x4c, 0x03, 0x1c, 0x16, 0x2f, 0x62, 
-  0x55, 0xbd, 0xb2, 0x58, 0xb3, 0xf9, 0xf7, 0x25, 0xd4, 0x8f, 0x83, 0x6b, 0xe5, 0x32, 0xca, 0xf3, 
-  0x6b, 0xee, 0x17, 0x27, 0x54, 0x89, 0x01, 0x0d, 0x47, 0x9a, 0x46, 0x07, 0xba, 0x54, 0xa0, 0xfa, 
-  0x1a, 0xc8, 0x64, 0x7d, 0xa9, 0xd9, 0xc3, 0xfa, 0x3a, 0xfb, 0x3d, 0x31, 0x9d, 0x56, 0xc9, 0x52, 
-  0x77, 0xe0, 0x60, 0x58, 0xbb, 0xa4, 0xd1, 0xd8, 0x83, 0x22, 0x3f, 0xac, 0xee, 0x3c, 0xcf, 0xfd, 
-  0x10, 0x43, 0x76, 0x07, 0x79, 0xa9, 0xe5, 0x38, 0x29, 0x3f, 0x81, 0x91, 0xf5, 0xa5, 0xe8, 0xf9, 
-  0x9f, 0x4d, 0x39, 0x48, 0x55, 0xb9, 0x4a, 0x09, 0x95, 0x60, 0xc9, 0xfd, 0x7f, 0xbf, 0x0f, 0xa8, 
-  0x3c, 0xf8, 0xfc, 0xb3, 0xfd, 0x3e, 0x84, 0x17, 0x0e, 0x3e, 0xff, 0xec, 0x7f, 0x01, 0x07, 0x92, 
-  0x1a, 0xb2, 0xe7, 0x7d, 0x00, 0x00
+const uint8_t _acedit_htm[7249] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0xed, 0x3d, 0xd9, 0x92, 0xdc, 0xc8, 
+  0x71, 0xef, 0xfc, 0x8a, 0x1a, 0x90, 0xda, 0x46, 0x2f, 0xfb, 0x9a, 0x21, 0x97, 0xa1, 0xed, 0x39, 
+  0x28, 0x9e, 0x5a, 0x4a, 0xbc, 0x82, 0xc3, 0xd5, 0xae, 0x82, 0xa2, 0x1c, 0x68, 0xa0, 0xba, 0xbb, 
+  0x48, 0x34, 0xd0, 0x46, 0x55, 0xcf, 0xb1, 0xd2, 0x38, 0x42, 0x8e, 0x0d, 0xf9, 0x51, 0x21, 0x1f, 
+  0xf2, 0x8b, 0x6d, 0xfd, 0x80, 0x3e, 0xc0, 0x76, 0x38, 0xfc, 0x31, 0xfa, 0x01, 0xeb, 0x13, 0x9c, 
+  0x99, 0x05, 0x74, 0xe3, 0xa8, 0x02, 0xd0, 0x33, 0xe4, 0x86, 0xe4, 0x30, 0x19, 0xbb, 0xdd, 0x04, 
+  0xea, 0xc8, 0xca, 0xca, 0x3b, 0xb3, 0xaa, 0x0f, 0xe6, 0x6a, 0x11, 0xb2, 0xd0, 0x8b, 0x66, 0x87, 
+  0x3c, 0x3a, 0xba, 0xc6, 0xe0, 0xcf, 0xc1, 0x82, 0x2b, 0x8f, 0xf9, 0x73, 0x2f, 0x91, 0x5c, 0x1d, 
+  0x3a, 0x2b, 0x35, 0xed, 0x7f, 0xdf, 0x49, 0x5f, 0x29, 0xa1, 0x42, 0x7e, 0xf4, 0x58, 0x84, 0x9c, 
+  0x2d, 0xbc, 0xc8, 0x9b, 0xf1, 0xe4, 0x60, 0xa8, 0x9f, 0xe9, 0xf7, 0x52, 0x9d, 0xe3, 0x2b, 0x1e, 
+  0x08, 0xef, 0x50, 0xfa, 0x09, 0xcf, 0xc6, 0xc4, 0x3f, 0x93, 0x38, 0x38, 0x67, 0xbf, 0x58, 0xff, 
+  0x13, 0xff, 0x4c, 0xe3, 0x48, 0xf5, 0xa5, 0xf8, 0x86, 0x8f, 0xd9, 0xee, 0xde, 0xf2, 0x6c, 0xbf, 
+  0xfa, 0x72, 0xea, 0x2d, 0x44, 0x78, 0x3e, 0x66, 0x3f, 0xe1, 0x49, 0x00, 0x13, 0xf6, 0xee, 0x25, 
+  0xc2, 0x0b, 0x7b, 0xc7, 0x5e, 0x24, 0xfb, 0x92, 0x27, 0x62, 0xba, 0xee, 0x71, 0x71, 0x6d, 0x33, 
+  0xd1, 0x4a, 0xa9, 0x38, 0x2a, 0x4d, 0x75, 0xc2, 0x13, 0x25, 0x7c, 0x2f, 0xec, 0x7b, 0xa1, 0x98, 
+  0x45, 0x63, 0xb6, 0x10, 0x41, 0x10, 0xf2, 0xe2, 0x8c, 0x73, 0x2e, 0x66, 0x73, 0x35, 0x66, 0x7b, 
+  0x15, 0x58, 0x02, 0x21, 0x97, 0xa1, 0x07, 0x70, 0x88, 0x28, 0x14, 0x11, 0xef, 0x4f, 0x43, 0x5e, 
+  0x6a, 0x41, 0xc3, 0xf6, 0x85, 0xe2, 0x0b, 0x39, 0x66, 0x3e, 0x8f, 0x14, 0x4f, 0x8a, 0x0d, 0xde, 
+  0xad, 0xa4, 0x12, 0xd3, 0xf3, 0xbe, 0x0f, 0xcb, 0x82, 0xd7, 0xd5, 0x46, 0xb9, 0x15, 0x88, 0x68, 
+  0xb9, 0x52, 0xdb, 0xc1, 0x9f, 0xeb, 0x3d, 0xa0, 0x29, 0xce, 0xd4, 0x33, 0x1e, 0xad, 0x4a, 0x58, 
+  0xf8, 0xa6, 0x2f, 0xa2, 0x80, 0x9f, 0x8d, 0xd9, 0xad, 0xd1, 0xa8, 0x08, 0xde, 0x32, 0x96, 0x42, 
+  0x89, 0x18, 0x46, 0xf6, 0x26, 0x32, 0x0e, 0x57, 0xaa, 0x84, 0x9b, 0x90, 0x4f, 0x01, 0xe6, 0xcf, 
+  0xca, 0x88, 0x99, 0xc4, 0x49, 0xc0, 0x13, 0xd8, 0xbe, 0xe5, 0x19, 0x83, 0x6e, 0x22, 0x60, 0xd7, 
+  0x7d, 0xdf, 0x37, 0xb5, 0xe9, 0x27, 0x5e, 0x20, 0x56, 0x80, 0x9c, 0xdb, 0x95, 0x31, 0x3c, 0xff, 
+  0xfd, 0x2c, 0x89, 0x57, 0x51, 0x00, 0xc8, 0x09, 0x63, 0x18, 0xed, 0xfa, 0x74, 0x3a, 0xb5, 0x6c, 
+  0x40, 0x14, 0x47, 0xbc, 0x3c, 0xfc, 0x59, 0x5f, 0xce, 0xbd, 0x20, 0x3e, 0x1d, 0xb3, 0x11, 0x83, 
+  0xad, 0x63, 0xdf, 0x87, 0xff, 0x92, 0xd9, 0xc4, 0x73, 0x47, 0x3d, 0xfc, 0x3b, 0xd8, 0xfd, 0xac, 
+  0xbb, 0x6f, 0xa5, 0xbb, 0x5b, 0x46, 0xba, 0x3b, 0x4d, 0x49, 0xe1, 0x76, 0x19, 0x4f, 0x05, 0xaa, 
+  0xec, 0x7b, 0xcb, 0x65, 0xc8, 0xfb, 0xf2, 0x5c, 0xc2, 0xbe, 0xf7, 0xd8, 0x7d, 0xa0, 0x8d, 0xf7, 
+  0xcf, 0x3c, 0xff, 0x98, 0xfe, 0xfd, 0x18, 0x5a, 0xf6, 0x58, 0xe7, 0x98, 0xcf, 0x62, 0xce, 0xbe, 
+  0x7c, 0xd2, 0xe9, 0xb1, 0x57, 0xf1, 0x24, 0x56, 0x71, 0x8f, 0xc9, 0x35, 0xf9, 0xe6, 0xf7, 0xcf, 
+  0xb8, 0x7d, 0xab, 0xb0, 0xb4, 0x83, 0xa1, 0x90, 0x00, 0x3a, 0xb2, 0x99, 0x09, 0x17, 0x0b, 0x2f, 
+  0x99, 0x09, 0xd8, 0xc3, 0xf2, 0xe6, 0x7a, 0x41, 0x20, 0xa2, 0x19, 0xe1, 0x3e, 0xff, 0x6e, 0x33, 
+  0xa9, 0x79, 0xf6, 0x50, 0x94, 0x66, 0xdf, 0x50, 0x49, 0xc2, 0x43, 0x4f, 0x89, 0x93, 0xf2, 0xfc, 
+  0x22, 0xea, 0x9f, 0x8a, 0x40, 0xcd, 0x01, 0xb1, 0x9f, 0x8d, 0xca, 0x98, 0xf5, 0x57, 0x89, 0xc4, 
+  0xed, 0x5d, 0xc6, 0xa2, 0xca, 0x1f, 0xf5, 0x0b, 0x5b, 0xaf, 0x00, 0xf7, 0x76, 0xf7, 0x4e, 0x79, 
+  0x64, 0xcb, 0xba, 0x55, 0x02, 0x98, 0x4e, 0x01, 0x2e, 0x53, 0x19, 0x1b, 0x01, 0x5d, 0x48, 0xc6, 
+  0x3d, 0xd9, 0x82, 0x8b, 0x42, 0x31, 0x9e, 0xc7, 0xc0, 0x82, 0x25, 0x74, 0x6c, 0xc6, 0x44, 0x9a, 
+  0x1d, 0xe1, 0xdf, 0x2d, 0xc6, 0x92, 0x4b, 0xaf, 0x2c, 0xa5, 0x32, 0xfa, 0x1f, 0x8d, 0x5a, 0x0c, 
+  0x34, 0xaf, 0x80, 0x93, 0x32, 0xe3, 0xc8, 0xc8, 0x7f, 0x2a, 0x5e, 0x16, 0xf8, 0x94, 0x8f, 0xf0, 
+  0xaf, 0x19, 0x8f, 0x15, 0x3a, 0xc9, 0x41, 0x20, 0x65, 0x5f, 0x81, 0x64, 0x3f, 0x11, 0xfc, 0x14, 
+  0xd6, 0xd2, 0x2b, 0x3e, 0xa8, 0xd0, 0xeb, 0x7a, 0xe3, 0x46, 0xad, 0x76, 0xac, 0x15, 0x15, 0xe8, 
+  0xa5, 0x00, 0xa7, 0x37, 0x03, 0x48, 0x92, 0xd4, 0x4a, 0xc4, 0x66, 0x51, 0x17, 0x2f, 0x3d, 0x5f, 
+  0x28, 0x60, 0xef, 0x51, 0xf3, 0xf8, 0x76, 0x7d, 0xb6, 0x5b, 0xa6, 0xd1, 0xfe, 0x22, 0xfe, 0xa6, 
+  0xbf, 0x02, 0xb6, 0x07, 0xd6, 0x0f, 0xb9, 0xaf, 0x4c, 0x0b, 0x04, 0xb9, 0x33, 0x79, 0x2f, 0x54, 
+  0x53, 0xb3, 0xca, 0xeb, 0x66, 0x40, 0x6b, 0x89, 0x6d, 0x5a, 0xcb, 0xa7, 0xed, 0x06, 0x37, 0x32, 
+  0x08, 0xd2, 0x6a, 0x3f, 0xe0, 0x7e, 0x9c, 0x78, 0x1a, 0xe3, 0xc0, 0x2a, 0x3c, 0x41, 0x15, 0xda, 
+  0x72, 0xeb, 0x6e, 0x86, 0xde, 0x84, 0x87, 0x37, 0x2b, 0x64, 0xb5, 0x26, 0x1f, 0xfa, 0xbb, 0xd7, 
+  0x9e, 0x16, 0xfe, 0xa6, 0x32, 0x54, 0x41, 0xb5, 0xb4, 0x20, 0x79, 0x04, 0xa8, 0x67, 0x78, 0x36, 
+  0x1e, 0x4f, 0xf8, 0x34, 0x4e, 0x78, 0x19, 0xcb, 0xdb, 0x22, 0x93, 0xc0, 0x1c, 0x03, 0x54, 0xde, 
+  0x24, 0xe4, 0x81, 0x46, 0x80, 0x65, 0xcc, 0x80, 0x4f, 0xbd, 0x55, 0xa8, 0x2c, 0xe4, 0x3b, 0xb8, 
+  0xd3, 0x76, 0x32, 0x7f, 0xce, 0xfd, 0xf7, 0x3c, 0x18, 0x47, 0xb1, 0x72, 0xd7, 0x33, 0x77, 0x6b, 
+  0x50, 0x35, 0x09, 0x63, 0xff, 0xfd, 0x07, 0xc0, 0x55, 0xaf, 0x4a, 0x47, 0x86, 0x47, 0x16, 0xcc, 
+  0x96, 0x8d, 0x32, 0x02, 0xca, 0x6c, 0xd1, 0x55, 0x35, 0x06, 0xf5, 0xb0, 0xbf, 0x36, 0x9b, 0x5b, 
+  0x2d, 0x57, 0x6c, 0xa3, 0x84, 0xcc, 0xf2, 0x73, 0xfe, 0xf4, 0xfb, 0x7f, 0xf8, 0x15, 0x73, 0xf6, 
+  0xd9, 0xf0, 0x53, 0xf6, 0x38, 0x0e, 0x81, 0x23, 0x98, 0x80, 0x97, 0xec, 0xd3, 0x61, 0xa1, 0x7d, 
+  0xaa, 0x48, 0xbd, 0x95, 0x8a, 0x5b, 0xc9, 0xce, 0xad, 0x4c, 0x44, 0x2b, 0x11, 0xdc, 0x6c, 0xbd, 
+  0x84, 0xbf, 0x4d, 0x97, 0xf0, 0x62, 0xc9, 0x23, 0x10, 0x7d, 0xc6, 0x75, 0xd4, 0x8b, 0x8c, 0x16, 
+  0x93, 0x7c, 0x9b, 0x4e, 0xf2, 0x50, 0x93, 0x3a, 0x9b, 0xa2, 0xef, 0x71, 0x55, 0x6c, 0xd5, 0x42, 
+  0x35, 0x50, 0x67, 0xaa, 0x0d, 0x64, 0xff, 0x9a, 0x42, 0xf6, 0x1a, 0x64, 0x9c, 0x19, 0xac, 0xfa, 
+  0x69, 0xc4, 0x62, 0xd6, 0x62, 0x9a, 0xdf, 0xfd, 0xd7, 0xff, 0xfc, 0xfb, 0x6f, 0xd2, 0x99, 0x9e, 
+  0x2c, 0xc0, 0xe3, 0x6a, 0x9c, 0xea, 0xfa, 0x9c, 0x7b, 0x41, 0x45, 0x12, 0x37, 0x29, 0x3d, 0x52, 
+  0xa9, 0x25, 0x82, 0x4a, 0x34, 0x77, 0x8c, 0x4c, 0x9e, 0xc0, 0xc8, 0xe2, 0x3a, 0x55, 0xac, 0xfb, 
+  0xb5, 0x01, 0x80, 0xa6, 0x07, 0x89, 0xeb, 0x46, 0xeb, 0xff, 0xf6, 0xed, 0xdb, 0xfb, 0x46, 0x4d, 
+  0xc5, 0xb9, 0x91, 0x05, 0xaf, 0x23, 0x62, 0x2f, 0xb3, 0xde, 0x3d, 0x83, 0x3f, 0x03, 0xbe, 0xe3, 
+  0xa2, 0xdd, 0x9a, 0x53, 0x8a, 0xdb, 0x1b, 0x7d, 0xcf, 0x6e, 0xab, 0x1a, 0xc1, 0x05, 0xf7, 0x58, 
+  0xc5, 0x49, 0xef, 0xfa, 0x32, 0x31, 0x19, 0x11, 0x97, 0x84, 0xdc, 0xbc, 0x59, 0xb5, 0xeb, 0x01, 
+  0xc8, 0x8d, 0xf0, 0x99, 0xe1, 0x32, 0x6c, 0x14, 0xec, 0x87, 0x65, 0xe9, 0x9f, 0x59, 0x96, 0x2e, 
+  0x95, 0xa7, 0x56, 0xf2, 0x32, 0x2b, 0xbe, 0x65, 0x59, 0xf0, 0xee, 0xc8, 0xe8, 0xc0, 0xa5, 0x56, 
+  0x98, 0x0d, 0x8e, 0xa9, 0x7c, 0xc6, 0x55, 0x85, 0x49, 0x32, 0xd7, 0x65, 0x34, 0xb2, 0x50, 0x71, 
+  0x3f, 0xc3, 0xa7, 0xc5, 0xe0, 0xb8, 0x7e, 0xea, 0x25, 0x11, 0xb4, 0x2b, 0x8d, 0xbb, 0xd6, 0x33, 
+  0xa3, 0x32, 0xad, 0x54, 0x91, 0x0a, 0xa6, 0x52, 0x34, 0xe3, 0xfb, 0x36, 0xb7, 0xc0, 0x28, 0x5c, 
+  0x54, 0x1c, 0x87, 0x4a, 0x2c, 0xb7, 0x44, 0xeb, 0x3a, 0x18, 0xb0, 0xd7, 0x86, 0x92, 0x34, 0xd9, 
+  0x55, 0x10, 0x73, 0x22, 0xa4, 0x98, 0x88, 0x90, 0x0c, 0x8e, 0x39, 0x28, 0x1c, 0x1e, 0x6d, 0xef, 
+  0xdc, 0x1b, 0xbd, 0x9e, 0xb5, 0xf9, 0x98, 0x6a, 0x33, 0x53, 0x4c, 0xc5, 0x10, 0x7d, 0xa8, 0x8c, 
+  0xb1, 0x26, 0xc9, 0x5b, 0x75, 0x74, 0x32, 0xaa, 0xdf, 0xcf, 0xd4, 0xb8, 0xb5, 0x20, 0x3a, 0x8f, 
+  0x03, 0xfa, 0x6e, 0xb6, 0x14, 0xae, 0x87, 0xb1, 0x17, 0x54, 0x89, 0xa3, 0x15, 0xf5, 0xf7, 0x81, 
+  0x74, 0x4e, 0xe6, 0xed, 0x85, 0x12, 0x36, 0x3f, 0xdd, 0xb7, 0x11, 0x61, 0x79, 0xa4, 0x35, 0x25, 
+  0xec, 0x8e, 0x1a, 0xa5, 0x73, 0x3e, 0xb0, 0x52, 0x8e, 0xab, 0x6c, 0x3c, 0x27, 0xbb, 0x1f, 0x9e, 
+  0xb6, 0x61, 0x83, 0xd4, 0xf9, 0x86, 0xa9, 0xfb, 0xf1, 0x4a, 0xd5, 0x21, 0x6c, 0x20, 0xe7, 0xf1, 
+  0x69, 0xd9, 0x7b, 0x31, 0x29, 0xac, 0xf5, 0xfc, 0xbb, 0x75, 0xc3, 0xf5, 0x17, 0x72, 0xb6, 0xbd, 
+  0x29, 0x79, 0x19, 0x05, 0x9a, 0x06, 0xcd, 0xca, 0x4c, 0x4f, 0xe8, 0x00, 0xbd, 0x0f, 0x72, 0x84, 
+  0xbe, 0x86, 0x9e, 0xe2, 0x5f, 0xbb, 0x7d, 0x68, 0xd7, 0x35, 0x33, 0x46, 0x85, 0x63, 0x72, 0xa4, 
+  0x7b, 0xcb, 0x22, 0x8a, 0x7e, 0xf0, 0x9e, 0x9f, 0x4f, 0x13, 0x6f, 0xc1, 0x25, 0x98, 0x1b, 0x22, 
+  0x8a, 0xc0, 0x63, 0xf4, 0x22, 0xb1, 0x28, 0x2d, 0x7c, 0xf4, 0xbd, 0xd2, 0x83, 0x12, 0x7c, 0x49, 
+  0x0c, 0x02, 0x9b, 0xbb, 0xa3, 0x6e, 0xa1, 0x51, 0x6e, 0x1a, 0xfc, 0x83, 0x62, 0xad, 0xd5, 0x30, 
+  0xb7, 0xee, 0x8c, 0x02, 0x3e, 0x2b, 0x8f, 0x65, 0x92, 0x68, 0x79, 0x90, 0xb5, 0x5b, 0x92, 0xf0, 
+  0xbf, 0x5e, 0x89, 0x04, 0xdc, 0x92, 0xab, 0x6c, 0x9d, 0x39, 0x6a, 0x45, 0x5b, 0x57, 0xd9, 0xa5, 
+  0x2d, 0x36, 0x8f, 0xf6, 0xae, 0x67, 0xd8, 0x40, 0x04, 0x3f, 0xf5, 0x7c, 0x0b, 0x9b, 0xb0, 0x2b, 
+  0x01, 0xdc, 0xa9, 0x88, 0x84, 0xe2, 0xe4, 0x89, 0x78, 0x36, 0xc1, 0x76, 0x27, 0x17, 0xaf, 0xe1, 
+  0xdc, 0x1c, 0x57, 0x45, 0xb6, 0xce, 0xb8, 0x93, 0x40, 0x5a, 0x7a, 0x09, 0x08, 0xcb, 0xda, 0x20, 
+  0xec, 0xad, 0xbd, 0xaa, 0xe5, 0x73, 0x86, 0x14, 0x45, 0xa2, 0x32, 0x6d, 0x0c, 0x8f, 0x4a, 0xfc, 
+  0x05, 0x42, 0x70, 0x1a, 0x62, 0xa0, 0xd5, 0x24, 0xea, 0x49, 0x5a, 0xa3, 0x20, 0x41, 0xd3, 0xb5, 
+  0xff, 0x39, 0xfc, 0x29, 0xcf, 0x91, 0x0a, 0xa7, 0x3b, 0x15, 0x23, 0x31, 0x93, 0x4d, 0xf8, 0xa6, 
+  0x14, 0x9d, 0x3c, 0x18, 0x52, 0x38, 0x28, 0x4b, 0x30, 0xf8, 0x89, 0x58, 0x2a, 0x26, 0x13, 0xff, 
+  0xd0, 0x99, 0x2b, 0xb5, 0x94, 0xe3, 0xe1, 0xd0, 0x0f, 0xa2, 0xc1, 0x3b, 0x19, 0xf0, 0x50, 0x9c, 
+  0x24, 0x83, 0x88, 0xab, 0x61, 0xb4, 0x5c, 0x0c, 0x3d, 0x1f, 0x48, 0x61, 0x25, 0xc2, 0x40, 0xfe, 
+  0x60, 0x77, 0x70, 0xfb, 0xd6, 0xe0, 0xd6, 0x10, 0xfa, 0xf4, 0x31, 0x3e, 0x19, 0xc5, 0x60, 0x3b, 
+  0x4f, 0x43, 0xe1, 0x2b, 0x6c, 0x34, 0x80, 0x47, 0xd0, 0xdb, 0x39, 0x82, 0x79, 0x68, 0x6c, 0x3d, 
+  0x51, 0x7e, 0xb6, 0x4d, 0x0a, 0xe3, 0xc4, 0x4b, 0x18, 0xda, 0x9a, 0x3d, 0x36, 0x95, 0x4f, 0xa2, 
+  0x69, 0xce, 0xd1, 0x80, 0x21, 0xa5, 0x62, 0x37, 0xd8, 0x21, 0x9b, 0xae, 0x22, 0x1f, 0x77, 0xdc, 
+  0xe5, 0x65, 0x4a, 0x4d, 0xb8, 0x5a, 0x25, 0x11, 0x0b, 0x62, 0x7f, 0xb5, 0x00, 0x1c, 0x0d, 0x66, 
+  0x5c, 0x3d, 0x0a, 0x39, 0x7e, 0xbd, 0x7f, 0xfe, 0x24, 0x80, 0xf6, 0x86, 0xb8, 0xac, 0x1e, 0xd7, 
+  0x0f, 0x63, 0xc9, 0x29, 0xe6, 0x57, 0x37, 0xbe, 0x98, 0x32, 0x77, 0x3d, 0x38, 0x66, 0x5b, 0x72, 
+  0x33, 0xc8, 0xfb, 0xe7, 0x0f, 0x42, 0x4f, 0xca, 0xe7, 0x20, 0x10, 0x5c, 0x27, 0x17, 0x45, 0x74, 
+  0xba, 0x83, 0x90, 0x47, 0x33, 0x35, 0xef, 0xb2, 0x62, 0xdf, 0x84, 0x2f, 0x60, 0xbb, 0x1f, 0xcc, 
+  0x01, 0x85, 0x30, 0x95, 0x29, 0x66, 0xcc, 0x58, 0x8f, 0x45, 0xfc, 0xf4, 0xd1, 0x62, 0xab, 0x55, 
+  0xfb, 0x09, 0x07, 0x8e, 0x49, 0xc1, 0x2a, 0x2c, 0x7a, 0x33, 0x47, 0x36, 0x1a, 0x93, 0x5c, 0x3d, 
+  0xd5, 0x42, 0xdb, 0x05, 0xa4, 0x47, 0xe5, 0xb1, 0x6f, 0xb8, 0x4e, 0x4e, 0xa6, 0xc3, 0x52, 0x88, 
+  0xc5, 0xbe, 0x78, 0xfd, 0xec, 0x29, 0x80, 0x14, 0xb1, 0x5f, 0xfe, 0x92, 0x39, 0x4e, 0xaf, 0xd0, 
+  0x83, 0xb3, 0xbb, 0xb9, 0x5e, 0xd0, 0xc3, 0x47, 0xac, 0x3c, 0x15, 0x52, 0x0d, 0xc0, 0x4e, 0x70, 
+  0x1d, 0xd2, 0x34, 0x4e, 0x97, 0x8d, 0x6d, 0xad, 0x34, 0x5a, 0xd6, 0x0d, 0x8b, 0xa3, 0x17, 0x31, 
+  0x48, 0x74, 0x3b, 0xd0, 0xb1, 0x1a, 0x80, 0x07, 0xa7, 0x76, 0x4e, 0x3d, 0xa1, 0x1c, 0x18, 0xdd, 
+  0x49, 0x43, 0x37, 0x8e, 0x01, 0xaf, 0xeb, 0xd5, 0x03, 0xa6, 0x02, 0x0c, 0xc5, 0x1c, 0x83, 0xa0, 
+  0x37, 0x6f, 0x37, 0x67, 0x07, 0x20, 0x7d, 0xf7, 0x6e, 0x77, 0x2b, 0xc2, 0x37, 0x45, 0x3b, 0x67, 
+  0x37, 0x99, 0xc3, 0xee, 0x3b, 0x65, 0xf5, 0x91, 0x30, 0x17, 0x89, 0x39, 0x02, 0xb8, 0xfa, 0xbb, 
+  0xfb, 0x2c, 0xba, 0x79, 0xb3, 0x57, 0x12, 0xe9, 0x7b, 0xb7, 0x61, 0x6c, 0x98, 0x60, 0x78, 0xa8, 
+  0x67, 0xd8, 0x67, 0xd5, 0x49, 0xf6, 0x4d, 0x3b, 0xcd, 0xc1, 0x4a, 0x7a, 0x2c, 0xce, 0x78, 0xe0, 
+  0xee, 0x75, 0x61, 0xf6, 0x37, 0x0e, 0xfb, 0xb1, 0xb8, 0xef, 0xf4, 0x00, 0x8c, 0x67, 0xe9, 0xe7, 
+  0x0f, 0xd3, 0xcf, 0xd7, 0xfa, 0xf3, 0x25, 0x7c, 0xbc, 0x7d, 0x13, 0xbd, 0xad, 0x47, 0xc5, 0x34, 
+  0xe1, 0x72, 0x7e, 0x4c, 0xee, 0x83, 0x6b, 0xa0, 0x03, 0xed, 0x58, 0x94, 0x48, 0xc0, 0x71, 0xd3, 
+  0x7e, 0x68, 0x44, 0x0c, 0x06, 0xdd, 0x12, 0x1a, 0x10, 0x03, 0x1c, 0x29, 0x05, 0x7c, 0x9d, 0xaf, 
+  0x9f, 0x3d, 0xfd, 0x02, 0xe4, 0xc9, 0x2b, 0xd0, 0x32, 0x5c, 0x96, 0x64, 0x27, 0x1f, 0xc4, 0x11, 
+  0xd2, 0x42, 0x9e, 0xce, 0xbb, 0x06, 0x85, 0x47, 0x18, 0xed, 0xb1, 0x52, 0x6f, 0xfc, 0xb3, 0x37, 
+  0x1a, 0xb1, 0x1d, 0x20, 0x81, 0x41, 0xea, 0xff, 0xdc, 0x65, 0x48, 0x3f, 0x38, 0xe1, 0xa3, 0x24, 
+  0x89, 0x13, 0xdc, 0xdc, 0x31, 0x73, 0x71, 0x37, 0x5c, 0x2d, 0x59, 0xe0, 0xdb, 0x8f, 0x8e, 0x5f, 
+  0x3c, 0x1f, 0x2c, 0x31, 0x0b, 0xeb, 0x72, 0x20, 0x3b, 0xb9, 0x04, 0x51, 0xc0, 0x31, 0xd8, 0xd0, 
+  0xed, 0x0e, 0xd4, 0xf9, 0x52, 0xef, 0x6c, 0x9f, 0x95, 0x08, 0x9c, 0xb0, 0x46, 0x43, 0x0c, 0x84, 
+  0x7c, 0xf1, 0x1e, 0x66, 0x82, 0x61, 0x6f, 0x02, 0x2a, 0x30, 0xad, 0x8b, 0x01, 0x9a, 0xe0, 0xb0, 
+  0x93, 0x3a, 0x3f, 0x1d, 0x4c, 0xd7, 0x1c, 0x76, 0x46, 0x1d, 0xb0, 0x9b, 0x94, 0x58, 0xac, 0x16, 
+  0xf8, 0x1d, 0xa4, 0xfb, 0x61, 0xe7, 0x73, 0x78, 0x36, 0x07, 0x89, 0x0c, 0xdf, 0x3e, 0x83, 0x56, 
+  0xde, 0xd9, 0x61, 0x07, 0x74, 0x7c, 0x07, 0x16, 0x18, 0xae, 0xf8, 0x61, 0xc7, 0x81, 0xa9, 0xdd, 
+  0x5d, 0xf8, 0xdf, 0x33, 0x4f, 0xcd, 0x07, 0x64, 0x1d, 0xba, 0x9f, 0x7f, 0xce, 0x3e, 0xcd, 0x26, 
+  0x5e, 0x49, 0x1e, 0xdc, 0x3f, 0x57, 0x60, 0x79, 0x0c, 0xb3, 0x47, 0x0a, 0x0c, 0x80, 0x90, 0x9e, 
+  0x75, 0x91, 0x28, 0x9c, 0x0e, 0xa3, 0xb4, 0x71, 0x3a, 0x96, 0x82, 0xe5, 0x16, 0x88, 0xbd, 0xd2, 
+  0x0b, 0x16, 0x5a, 0x1e, 0x9c, 0xc6, 0x61, 0x53, 0x74, 0xfd, 0xe3, 0x29, 0xc3, 0x71, 0xea, 0x87, 
+  0x48, 0x27, 0x3e, 0xc2, 0x96, 0x0a, 0xbf, 0x1e, 0x0c, 0x09, 0x25, 0x47, 0x76, 0x0c, 0xae, 0x22, 
+  0xb9, 0x5a, 0x2e, 0xe3, 0x44, 0xf1, 0x00, 0x73, 0xde, 0x92, 0x7d, 0xf2, 0x49, 0x86, 0x4e, 0x50, 
+  0x0e, 0x18, 0x51, 0x47, 0x74, 0xa6, 0x3e, 0x42, 0xe7, 0xe8, 0xab, 0x7b, 0xaf, 0x9e, 0x3f, 0x79, 
+  0xfe, 0x43, 0xfd, 0x86, 0x44, 0xc6, 0x61, 0x27, 0xf5, 0x18, 0x3a, 0x94, 0x34, 0xd7, 0x89, 0x42, 
+  0x8a, 0xef, 0x78, 0x22, 0x92, 0x2c, 0x37, 0x3e, 0x85, 0x75, 0x22, 0x34, 0xd7, 0xc6, 0x07, 0x93, 
+  0x64, 0x48, 0x50, 0xda, 0xa0, 0x20, 0xd8, 0x71, 0x92, 0xa3, 0xf4, 0xc3, 0xe9, 0x22, 0xfd, 0xa4, 
+  0xfb, 0x4c, 0xb3, 0x93, 0xec, 0x39, 0xec, 0x54, 0xcc, 0x77, 0x30, 0xa0, 0xf6, 0xf5, 0xb7, 0xd3, 
+  0x39, 0x18, 0x1f, 0xfb, 0xf9, 0x64, 0xe7, 0x24, 0x0e, 0x83, 0xce, 0xd1, 0x93, 0xe7, 0x4f, 0x5e, 
+  0xb3, 0x47, 0xaf, 0x5e, 0xbd, 0x78, 0xc5, 0x76, 0xb2, 0xe1, 0xab, 0x08, 0xb2, 0x71, 0x5c, 0x54, 
+  0x6d, 0xea, 0x1c, 0xbf, 0x7c, 0xf2, 0xf8, 0xf1, 0xb1, 0x83, 0x0c, 0x90, 0x6d, 0x0a, 0x92, 0x2f, 
+  0xe2, 0x12, 0x86, 0x59, 0xbc, 0x0f, 0x44, 0x02, 0xa3, 0x68, 0x69, 0x99, 0x5a, 0x73, 0xc8, 0xbb, 
+  0xda, 0x9e, 0x83, 0xa5, 0x59, 0xcc, 0x45, 0x52, 0x40, 0x65, 0x3e, 0x5d, 0xf2, 0xc8, 0x75, 0x7e, 
+  0xf8, 0xe8, 0x35, 0xca, 0x95, 0x61, 0x0a, 0x61, 0x8f, 0xed, 0x8c, 0xba, 0xe5, 0x96, 0x92, 0x03, 
+  0xd1, 0x46, 0xab, 0x30, 0xec, 0xd6, 0x89, 0x9d, 0x0a, 0x97, 0xfe, 0xa2, 0x94, 0xf4, 0xe7, 0x89, 
+  0x72, 0x1d, 0xc2, 0xd6, 0x18, 0x25, 0xdd, 0xcd, 0x0d, 0x8b, 0xc3, 0x26, 0xbd, 0x65, 0xfa, 0x49, 
+  0x81, 0x79, 0xeb, 0xa6, 0x43, 0xed, 0xf0, 0x90, 0x87, 0x40, 0x95, 0x3f, 0x8a, 0x27, 0x46, 0x8d, 
+  0x37, 0x1c, 0xb2, 0xa7, 0x5e, 0x82, 0x51, 0x40, 0x8a, 0xb7, 0x4a, 0x06, 0xa6, 0x1e, 0x0b, 0xa8, 
+  0x4b, 0x00, 0x26, 0x65, 0x21, 0x23, 0x99, 0xca, 0x3e, 0xa6, 0xe6, 0x9c, 0x69, 0x93, 0x90, 0x9d, 
+  0xce, 0x79, 0x44, 0xff, 0x7e, 0x17, 0x4f, 0x98, 0x90, 0x64, 0xd0, 0x55, 0x44, 0xa2, 0xea, 0x31, 
+  0x0f, 0x36, 0x60, 0x67, 0xb7, 0xc7, 0x24, 0x7c, 0x82, 0x11, 0xf1, 0x92, 0x7a, 0xeb, 0x50, 0xb5, 
+  0x0b, 0x30, 0xa1, 0x62, 0x1d, 0x02, 0x5e, 0x51, 0x4c, 0x45, 0x03, 0xb9, 0x9a, 0x48, 0x95, 0xa0, 
+  0x8e, 0x8e, 0x06, 0x40, 0xf4, 0xea, 0x09, 0xfa, 0x92, 0x2f, 0xa6, 0x2e, 0x34, 0x41, 0x96, 0xdb, 
+  0xed, 0xf6, 0x98, 0x68, 0x12, 0x9d, 0x1e, 0x8e, 0xe9, 0xd2, 0xb4, 0xa3, 0x2a, 0x09, 0x29, 0x24, 
+  0x16, 0x30, 0x1d, 0xd0, 0x0c, 0x72, 0xbb, 0x3d, 0x83, 0xb2, 0xa3, 0x95, 0xbe, 0x04, 0x71, 0xe4, 
+  0x4a, 0xfb, 0xfb, 0x4c, 0x7b, 0x94, 0x28, 0xaa, 0xc7, 0xc2, 0x5a, 0x0b, 0x66, 0x2d, 0xda, 0x5b, 
+  0xa8, 0x0a, 0xfc, 0x13, 0xb5, 0x54, 0x17, 0x99, 0x62, 0x38, 0x24, 0x24, 0x6a, 0xaa, 0x81, 0x75, 
+  0xe6, 0xe4, 0x7e, 0x54, 0x24, 0x9d, 0x81, 0x8c, 0xc1, 0x7a, 0xab, 0x07, 0xb4, 0xa2, 0x8c, 0x51, 
+  0xa6, 0xe0, 0x14, 0xb1, 0xb1, 0xe9, 0x45, 0x17, 0x34, 0x04, 0xf1, 0x22, 0x98, 0x5a, 0xaf, 0xc5, 
+  0x82, 0x83, 0x2b, 0xee, 0x36, 0x42, 0x4d, 0xee, 0x91, 0xbb, 0x33, 0xea, 0x9a, 0xc7, 0xec, 0x61, 
+  0xf2, 0x7f, 0x84, 0x22, 0x49, 0xb8, 0xd5, 0x26, 0x17, 0x95, 0x27, 0x3d, 0x13, 0x0a, 0x0b, 0x9c, 
+  0x8c, 0x69, 0xe1, 0xbb, 0x20, 0x27, 0x0e, 0x91, 0xa1, 0xa4, 0x81, 0xa1, 0x75, 0x27, 0x03, 0x53, 
+  0x97, 0x2c, 0x4b, 0xed, 0xc1, 0x9d, 0x1b, 0xd6, 0x45, 0x4a, 0x08, 0xb7, 0xf7, 0x2b, 0x3e, 0x39, 
+  0x06, 0x17, 0x92, 0x2b, 0xd7, 0x4d, 0x5d, 0x0c, 0x07, 0xf1, 0x07, 0x6e, 0x25, 0x79, 0x72, 0x83, 
+  0x25, 0x38, 0xb3, 0xe0, 0x42, 0x84, 0x64, 0xce, 0x49, 0x7c, 0x3b, 0xc6, 0x2f, 0x63, 0x22, 0x76, 
+  0x67, 0x38, 0x44, 0x10, 0xd7, 0x8d, 0xe7, 0xb1, 0x54, 0xb4, 0x03, 0xf0, 0x6a, 0x4c, 0xba, 0xee, 
+  0xf9, 0x6a, 0x31, 0x01, 0x2e, 0xda, 0x0c, 0x07, 0x82, 0x9d, 0x88, 0xbf, 0x69, 0xb2, 0xdb, 0xb7, 
+  0x6f, 0xc1, 0x4c, 0xdf, 0x1f, 0x91, 0x1e, 0xdb, 0xd3, 0x93, 0x81, 0x74, 0x04, 0x62, 0x43, 0x5c, 
+  0xb5, 0x21, 0x36, 0xd8, 0xb2, 0xdd, 0xcb, 0xed, 0x87, 0x82, 0x59, 0x40, 0x35, 0x49, 0xcc, 0x3f, 
+  0xe4, 0x26, 0x52, 0xb6, 0x99, 0x90, 0x5d, 0x64, 0xd1, 0x86, 0x51, 0x83, 0xc0, 0x53, 0x5e, 0x77, 
+  0xdf, 0xd8, 0xde, 0xe1, 0x27, 0x8a, 0x16, 0x2e, 0xd7, 0xba, 0xc1, 0x99, 0xca, 0x81, 0x16, 0x6c, 
+  0xe9, 0x0b, 0x42, 0x23, 0x12, 0x2a, 0x0c, 0x78, 0x8e, 0xfc, 0x35, 0x00, 0xaf, 0xf8, 0xf0, 0x50, 
+  0x53, 0xaf, 0x93, 0xac, 0x22, 0x54, 0xc2, 0xa4, 0x65, 0x36, 0x2d, 0x90, 0xab, 0xb4, 0xa6, 0x71, 
+  0xa6, 0x1e, 0xe8, 0xce, 0x20, 0x1d, 0xab, 0xf2, 0xbe, 0x28, 0xc9, 0x7d, 0x2f, 0xea, 0xa8, 0x54, 
+  0xac, 0x32, 0x32, 0x51, 0x22, 0xb2, 0x1d, 0x1c, 0x03, 0xd5, 0x91, 0x29, 0x5e, 0x96, 0x29, 0xdb, 
+  0xe0, 0x95, 0xa3, 0x6e, 0x69, 0xb3, 0x7d, 0x24, 0x23, 0xcd, 0x6c, 0x57, 0x9c, 0xeb, 0x02, 0x16, 
+  0xa0, 0xfc, 0x39, 0x33, 0x4b, 0x88, 0xea, 0x08, 0x17, 0x75, 0x3a, 0x09, 0x70, 0x81, 0x2e, 0xd8, 
+  0x73, 0x7e, 0xfa, 0x40, 0xa7, 0xa5, 0xaa, 0xe6, 0x77, 0x2a, 0x6b, 0x76, 0x76, 0xd0, 0x2a, 0xf0, 
+  0x4e, 0xf8, 0x7d, 0x05, 0x9e, 0xd1, 0x20, 0xcb, 0x23, 0x23, 0xd4, 0x3b, 0x3b, 0xe8, 0x73, 0x8b, 
+  0x64, 0xe1, 0x3a, 0x0f, 0xe6, 0x18, 0xdf, 0x96, 0x4c, 0xc5, 0xec, 0x3c, 0x5e, 0x25, 0x6b, 0x9f, 
+  0x89, 0x9d, 0x8a, 0x30, 0x64, 0x13, 0x0e, 0xb4, 0x0f, 0x1e, 0x2f, 0x38, 0x37, 0xf0, 0x96, 0x2c, 
+  0x25, 0x11, 0xad, 0xc0, 0x0a, 0xa0, 0x4d, 0x04, 0x03, 0x09, 0xcd, 0x3b, 0x98, 0xe2, 0xa1, 0x90, 
+  0xbe, 0x97, 0x04, 0x30, 0x93, 0x44, 0xa2, 0x2e, 0x62, 0x36, 0xbf, 0x3e, 0xc3, 0x8a, 0xcc, 0xa3, 
+  0x70, 0x93, 0x53, 0x51, 0x5d, 0x0c, 0x28, 0x28, 0xde, 0x2b, 0xb7, 0x0b, 0xd6, 0xe3, 0x94, 0x9b, 
+  0xd6, 0xc1, 0x51, 0x56, 0xac, 0x36, 0xd7, 0xd9, 0x45, 0x9e, 0xa3, 0xff, 0x91, 0x71, 0x91, 0x28, 
+  0xf9, 0x95, 0x00, 0x45, 0x47, 0xea, 0x15, 0x85, 0xf7, 0x18, 0x05, 0x01, 0x1a, 0x1a, 0xdd, 0x01, 
+  0xc8, 0xbf, 0xe2, 0xcb, 0x81, 0x0c, 0x85, 0xcf, 0xdd, 0x51, 0x0f, 0xdc, 0x3c, 0x14, 0xc8, 0xd0, 
+  0x66, 0xa3, 0xae, 0xe1, 0x29, 0xaf, 0x68, 0xec, 0x5a, 0xd4, 0x69, 0xe7, 0xfd, 0x0b, 0x4a, 0x30, 
+  0x92, 0x7d, 0x02, 0xde, 0x4e, 0x19, 0x6a, 0xe4, 0x7d, 0x54, 0xe4, 0x37, 0xf2, 0xce, 0x7d, 0x16, 
+  0x2f, 0x10, 0x5a, 0xc8, 0x3e, 0x02, 0x42, 0xa0, 0xac, 0xb3, 0x53, 0x12, 0x08, 0x42, 0xf3, 0x3f, 
+  0x98, 0x7f, 0x68, 0x0f, 0x97, 0x0c, 0x4f, 0x31, 0x58, 0xac, 0xd0, 0x98, 0x0e, 0xb9, 0x36, 0x4f, 
+  0x4a, 0x2f, 0xb5, 0xa6, 0x03, 0xd7, 0x1a, 0xe4, 0x4c, 0xa9, 0xa7, 0x37, 0xf0, 0x96, 0x20, 0x24, 
+  0x03, 0x1d, 0xce, 0x10, 0xdd, 0xaa, 0x1f, 0x18, 0x37, 0x00, 0x16, 0x93, 0xb4, 0x61, 0xce, 0x12, 
+  0x6c, 0x8c, 0x27, 0xd4, 0xa0, 0x57, 0x7a, 0x9f, 0x01, 0x8e, 0x91, 0x95, 0xca, 0xcb, 0x0c, 0x36, 
+  0xec, 0x5e, 0x79, 0x99, 0xc6, 0x02, 0x7e, 0x82, 0xde, 0x15, 0x36, 0x1a, 0xd6, 0x42, 0x1f, 0x1b, 
+  0xa0, 0x97, 0x1b, 0xe8, 0x75, 0xf5, 0x6b, 0x19, 0x7c, 0x59, 0xf4, 0x8b, 0xff, 0xf8, 0x87, 0x5f, 
+  0x63, 0x5a, 0xf9, 0xcb, 0x25, 0x4a, 0xc1, 0xda, 0xd9, 0xa4, 0x61, 0xb6, 0xb0, 0x69, 0xb6, 0x30, 
+  0x45, 0x96, 0xb6, 0xed, 0x7b, 0xa5, 0x77, 0x15, 0x4b, 0x1f, 0x0b, 0x6f, 0x2a, 0xad, 0x0a, 0xf0, 
+  0x52, 0xc1, 0xc4, 0xb3, 0xf7, 0x0f, 0x2b, 0xa3, 0x15, 0x81, 0x0d, 0x0d, 0xc0, 0x06, 0x4d, 0xc0, 
+  0x06, 0x95, 0xa9, 0xbe, 0x85, 0xa9, 0x1e, 0x57, 0xc9, 0xaf, 0x38, 0x57, 0x60, 0x98, 0x2b, 0xd9, 
+  0xcc, 0x85, 0x8e, 0x53, 0x79, 0xa6, 0x24, 0x45, 0x8b, 0xce, 0xff, 0xde, 0x27, 0x68, 0x64, 0x69, 
+  0x92, 0xa4, 0x15, 0x7a, 0x8a, 0xa0, 0x24, 0x06, 0x50, 0xfc, 0xa6, 0x65, 0xfb, 0x29, 0x30, 0x99, 
+  0x8c, 0xeb, 0x95, 0xdf, 0x16, 0x91, 0xf2, 0xf7, 0xff, 0xcd, 0x50, 0x62, 0x56, 0x9a, 0x69, 0x68, 
+  0x75, 0x8d, 0xc5, 0x53, 0x3e, 0x45, 0x23, 0xca, 0xb9, 0x35, 0x5a, 0x9e, 0x55, 0x1a, 0xe6, 0xc5, 
+  0xe2, 0xa8, 0xbc, 0xe6, 0xfc, 0x6a, 0x7c, 0xc3, 0x6a, 0x96, 0x4d, 0xab, 0x59, 0xa6, 0xab, 0xc9, 
+  0x49, 0xe2, 0x5e, 0xb9, 0x41, 0x81, 0x01, 0x7e, 0xfd, 0x9f, 0x2c, 0x95, 0xfe, 0x95, 0x86, 0xad, 
+  0x21, 0x5d, 0x96, 0xf4, 0x8e, 0xcb, 0x37, 0x60, 0x7a, 0x68, 0x9a, 0x69, 0x98, 0x3c, 0x9f, 0x3f, 
+  0x15, 0xd1, 0xfb, 0x72, 0x24, 0xb2, 0x04, 0xd0, 0xb7, 0xff, 0x81, 0x1c, 0x79, 0xcf, 0xe7, 0xec, 
+  0x11, 0x91, 0x47, 0xa5, 0xf9, 0x1c, 0xbc, 0x18, 0x6c, 0x99, 0x85, 0xbd, 0x67, 0x20, 0xe7, 0x57, 
+  0x93, 0x81, 0x1f, 0x2f, 0x86, 0xde, 0x3b, 0xef, 0x2c, 0x4e, 0x66, 0x18, 0xcf, 0x1e, 0x9e, 0x8a, 
+  0xf7, 0x62, 0x98, 0x56, 0xcb, 0xf4, 0x7f, 0xcc, 0xcf, 0x27, 0x31, 0xac, 0xb1, 0x7f, 0x3c, 0x07, 
+  0x33, 0xd3, 0x5f, 0x29, 0x59, 0x19, 0x56, 0xa1, 0x3b, 0x49, 0xdb, 0xf6, 0x57, 0x93, 0xd0, 0x33, 
+  0x80, 0x99, 0xf0, 0x50, 0x53, 0x21, 0x9a, 0x99, 0x1c, 0xdc, 0xa0, 0x18, 0x00, 0x01, 0xa3, 0x85, 
+  0x57, 0x41, 0x34, 0x11, 0xc3, 0x6e, 0x95, 0x18, 0xb2, 0x86, 0xba, 0x0e, 0x17, 0xda, 0x5c, 0x1f, 
+  0x8d, 0xee, 0xdc, 0xf1, 0x7d, 0x4b, 0x33, 0x14, 0xa8, 0x0f, 0xd7, 0x35, 0x84, 0x16, 0x8e, 0x28, 
+  0xee, 0x0c, 0x2f, 0xef, 0x4c, 0x85, 0x33, 0xb3, 0xcd, 0xc9, 0x62, 0x04, 0x65, 0x46, 0x2d, 0x44, 
+  0x11, 0xd3, 0x40, 0x70, 0xb7, 0x81, 0x0b, 0xcb, 0x0a, 0x29, 0x8e, 0x7c, 0x32, 0x76, 0xda, 0x79, 
+  0x97, 0x55, 0xcb, 0x18, 0x63, 0x86, 0x87, 0x30, 0x0e, 0xaa, 0x42, 0x99, 0x86, 0xe9, 0xd3, 0x10, 
+  0xd4, 0xfa, 0xf1, 0x9b, 0xd1, 0x5b, 0x52, 0x2e, 0x55, 0xdb, 0x32, 0x1e, 0x50, 0xb8, 0xae, 0x62, 
+  0x32, 0xa0, 0xaf, 0x91, 0xbe, 0xd3, 0xca, 0x06, 0x4c, 0x87, 0xf4, 0xdf, 0x5d, 0xeb, 0x28, 0x86, 
+  0x38, 0x40, 0xd6, 0x47, 0x3b, 0x22, 0x68, 0x23, 0xb7, 0x8f, 0xd4, 0x48, 0xc4, 0x0d, 0x58, 0x26, 
+  0xef, 0x1b, 0x51, 0x63, 0xc3, 0x01, 0xb8, 0x56, 0xc0, 0x07, 0x5a, 0x81, 0xb9, 0x1b, 0x5c, 0xf4, 
+  0xd6, 0x4b, 0x69, 0x0d, 0x4b, 0xd0, 0x1a, 0x16, 0x0a, 0x8e, 0x40, 0xab, 0x0c, 0xb3, 0x60, 0x45, 
+  0x2d, 0x5c, 0x83, 0x47, 0xe3, 0xa0, 0x97, 0x71, 0x08, 0x4d, 0xef, 0x66, 0x7e, 0xc5, 0xbd, 0x75, 
+  0x78, 0x8f, 0x2d, 0x56, 0x60, 0xde, 0x82, 0x99, 0x3b, 0x13, 0x27, 0x5c, 0x67, 0x1a, 0x54, 0xc5, 
+  0x6c, 0x4b, 0x7b, 0x3d, 0xce, 0x42, 0x82, 0xba, 0x53, 0x14, 0x2b, 0xb0, 0x5d, 0x03, 0x30, 0x94, 
+  0x01, 0x05, 0x1e, 0xeb, 0x0c, 0x3b, 0x74, 0x4a, 0xc7, 0xf3, 0x15, 0xb0, 0x22, 0x05, 0x00, 0x09, 
+  0x27, 0x0f, 0xc8, 0x46, 0x73, 0x55, 0x7b, 0x0c, 0x84, 0xdf, 0x0d, 0x06, 0x74, 0x85, 0xa0, 0x05, 
+  0x09, 0x6e, 0x19, 0x0b, 0x48, 0xa6, 0x8a, 0x22, 0x9a, 0x43, 0xc7, 0xe8, 0xec, 0x17, 0xd6, 0xda, 
+  0x7e, 0xb1, 0x7e, 0xeb, 0xc5, 0xaa, 0x01, 0xea, 0x46, 0xb7, 0xfd, 0xd0, 0xcb, 0x2d, 0x86, 0x4e, 
+  0x15, 0x95, 0xbb, 0x8d, 0x27, 0x46, 0x8b, 0x7d, 0x9d, 0x70, 0x6e, 0x0c, 0x0d, 0x66, 0x7b, 0x03, 
+  0xfe, 0x48, 0x5a, 0xc0, 0xe5, 0x54, 0xed, 0x6f, 0x6f, 0x23, 0x07, 0x03, 0x71, 0xe2, 0x54, 0xb6, 
+  0xae, 0x98, 0x26, 0xca, 0x66, 0x16, 0xa6, 0x55, 0xe8, 0xd4, 0xe4, 0x99, 0xd2, 0x7e, 0xc9, 0x32, 
+  0x14, 0xca, 0xed, 0x0c, 0x3a, 0xdd, 0xc1, 0x32, 0x5e, 0xba, 0xdd, 0x81, 0x8a, 0x9f, 0xc6, 0xa7, 
+  0x3c, 0x79, 0xe0, 0x61, 0xc4, 0x6e, 0xdf, 0xd2, 0x15, 0xcd, 0xd6, 0x37, 0x1d, 0x75, 0xa6, 0x3a, 
+  0x3d, 0xd6, 0x99, 0xab, 0x45, 0xfa, 0x11, 0xe2, 0xe7, 0x3b, 0xa9, 0xff, 0x1f, 0x47, 0xf8, 0xe9, 
+  0x2f, 0x97, 0xf4, 0x21, 0xe9, 0xe9, 0x99, 0x6e, 0x72, 0xee, 0xe9, 0x4f, 0x5f, 0x9e, 0xe0, 0xc7, 
+  0xec, 0x9b, 0xce, 0xdb, 0xf2, 0x4c, 0xa9, 0x0b, 0x05, 0x53, 0x81, 0x48, 0xf7, 0xc3, 0x55, 0xc0, 
+  0xa5, 0x7b, 0xa6, 0x88, 0xba, 0x10, 0x72, 0x0c, 0x1f, 0xd4, 0x6c, 0xaf, 0x19, 0x1b, 0xb1, 0x1d, 
+  0x1b, 0x57, 0x40, 0x06, 0xa1, 0x62, 0x19, 0xcd, 0x68, 0xd5, 0xcb, 0xf4, 0x83, 0xd3, 0xe7, 0x4c, 
+  0x4c, 0xf1, 0x43, 0xf8, 0x31, 0x7e, 0xc8, 0x13, 0x7a, 0x38, 0x59, 0x2c, 0xed, 0xcb, 0xdd, 0x2c, 
+  0x56, 0x95, 0xe6, 0xbb, 0x68, 0xb5, 0xe1, 0xd2, 0x48, 0x61, 0x79, 0x2a, 0x4b, 0x89, 0x68, 0x15, 
+  0x3a, 0x06, 0xf6, 0xe7, 0x05, 0xc5, 0xa8, 0x0c, 0x2d, 0x32, 0x27, 0x31, 0x1d, 0x26, 0x14, 0xa6, 
+  0x61, 0x54, 0x61, 0x18, 0xcf, 0x20, 0x05, 0xbc, 0xa2, 0xa2, 0xa6, 0xdc, 0xc7, 0xd1, 0x1f, 0xff, 
+  0xe5, 0x37, 0x68, 0x4a, 0xbd, 0x22, 0xd9, 0x39, 0x7c, 0x16, 0x9f, 0x70, 0x7b, 0x1e, 0xc3, 0x33, 
+  0xb1, 0xac, 0x35, 0xac, 0xb5, 0xce, 0xc3, 0x17, 0x32, 0xe2, 0xa6, 0x75, 0x2d, 0x93, 0x78, 0xb1, 
+  0x04, 0xb1, 0xa7, 0x81, 0x60, 0xeb, 0x10, 0x12, 0x53, 0xb1, 0x83, 0x98, 0x35, 0xf7, 0xc6, 0xd0, 
+  0x25, 0x06, 0xb0, 0x3c, 0x0a, 0x49, 0xe1, 0xb7, 0x08, 0xbf, 0x2d, 0x5d, 0xf0, 0xb3, 0xbd, 0xcb, 
+  0x45, 0x98, 0x4a, 0x48, 0xee, 0x7d, 0x30, 0x24, 0xff, 0xe1, 0xef, 0x10, 0xc9, 0x0f, 0xe3, 0x53, 
+  0x8a, 0x75, 0x7f, 0x28, 0x0c, 0x13, 0xfe, 0x7a, 0x4c, 0xec, 0x37, 0xe2, 0xbf, 0x67, 0x89, 0x91, 
+  0x19, 0x73, 0x50, 0x64, 0x03, 0x0a, 0x63, 0xfc, 0xbe, 0x5b, 0x08, 0x35, 0x7b, 0x96, 0xd8, 0xb2, 
+  0x36, 0xe8, 0xd6, 0xd1, 0xf8, 0xd4, 0xd5, 0x9f, 0x84, 0xf1, 0xc4, 0xb1, 0x35, 0x6e, 0x9f, 0x04, 
+  0x28, 0xe7, 0xa2, 0xef, 0xc3, 0xb0, 0xee, 0x9b, 0xcd, 0x74, 0x6f, 0x7b, 0xf6, 0x7e, 0xb4, 0x85, 
+  0x00, 0xce, 0x18, 0xfc, 0x8c, 0x25, 0xc8, 0x1d, 0x1d, 0x37, 0x1e, 0xc6, 0x60, 0x14, 0x28, 0xa9, 
+  0x40, 0x63, 0x2c, 0x1c, 0x6b, 0xdf, 0x8b, 0x6e, 0xcd, 0xb0, 0x3d, 0xca, 0x77, 0xb8, 0xa7, 0x22, 
+  0x0a, 0xe2, 0xd3, 0xc1, 0x97, 0xaf, 0x9e, 0xa2, 0xcc, 0x4c, 0xff, 0xa5, 0x4f, 0x29, 0xc1, 0xb3, 
+  0x6e, 0x5a, 0xce, 0xf1, 0x62, 0xf2, 0x8e, 0xfb, 0xf8, 0xa0, 0x1a, 0xf3, 0x29, 0x8e, 0x89, 0xa2, 
+  0xc3, 0x52, 0x0a, 0x82, 0x2e, 0xd3, 0xbe, 0xb5, 0x33, 0x28, 0x63, 0xae, 0xee, 0x29, 0x30, 0x38, 
+  0xc0, 0x01, 0xe4, 0xa0, 0xbd, 0x52, 0xc2, 0xc3, 0x3d, 0x03, 0x44, 0x81, 0xaf, 0xec, 0x73, 0x77, 
+  0xf8, 0xf3, 0xc1, 0xa7, 0x6f, 0x7e, 0xf6, 0xb3, 0xe1, 0xdb, 0x61, 0x0f, 0x4c, 0x90, 0xae, 0x65, 
+  0x1f, 0x4d, 0xc3, 0xa1, 0x73, 0x45, 0x8c, 0x69, 0xef, 0x52, 0x2c, 0xee, 0x28, 0x0a, 0xb8, 0xba, 
+  0x89, 0x88, 0xf8, 0xdd, 0xd6, 0x03, 0xe7, 0xeb, 0x6e, 0x94, 0x25, 0xc1, 0x62, 0x7c, 0x6a, 0xa3, 
+  0x43, 0x4a, 0x8a, 0x5c, 0x4e, 0x78, 0xc4, 0x98, 0xec, 0x43, 0x87, 0xe3, 0x63, 0x49, 0x91, 0x3f, 
+  0xfd, 0xfe, 0xb7, 0xbf, 0x42, 0x31, 0xf2, 0x13, 0x2c, 0x37, 0xf7, 0x24, 0x95, 0x90, 0x7d, 0x0c, 
+  0x61, 0x6d, 0x11, 0x16, 0x4a, 0x71, 0x90, 0xd2, 0x18, 0xde, 0xbe, 0x27, 0x31, 0xc3, 0xe6, 0x46, 
+  0x6d, 0xf0, 0xd4, 0xbd, 0x84, 0x94, 0xf5, 0x52, 0x5f, 0x36, 0x3d, 0x05, 0xf6, 0xe8, 0x04, 0x03, 
+  0xe9, 0x16, 0x57, 0xb6, 0xd0, 0x5e, 0x57, 0x2f, 0x63, 0xcb, 0x91, 0xf3, 0x21, 0xd0, 0x3e, 0x37, 
+  0xd6, 0x3b, 0x7c, 0xbc, 0xfd, 0xfd, 0xe7, 0xdf, 0x92, 0x9a, 0xa0, 0x54, 0xca, 0x77, 0xb7, 0xb3, 
+  0xeb, 0x6c, 0x83, 0x9e, 0x58, 0x9f, 0x99, 0x59, 0x2b, 0xe1, 0xbb, 0x3a, 0x9d, 0xb0, 0x6a, 0xde, 
+  0xee, 0x0b, 0xb3, 0x79, 0x14, 0xda, 0x62, 0xdf, 0x06, 0xd3, 0x86, 0xcc, 0xec, 0x6b, 0x26, 0x59, 
+  0x28, 0xf2, 0xb2, 0x50, 0x57, 0x8c, 0xf9, 0x49, 0x1c, 0x86, 0xaf, 0xe3, 0x25, 0xca, 0xda, 0xf5, 
+  0xab, 0xec, 0x4b, 0x2a, 0x28, 0x37, 0xad, 0x8c, 0xa3, 0xc6, 0x96, 0x51, 0x29, 0x1e, 0xd3, 0x3c, 
+  0x2c, 0x36, 0x33, 0x8e, 0x1b, 0x92, 0x69, 0x0b, 0x9b, 0x04, 0x6d, 0xbf, 0xc6, 0x90, 0x81, 0xb1, 
+  0x55, 0x90, 0x6b, 0xf5, 0x53, 0x68, 0x65, 0x50, 0xe4, 0x9e, 0xae, 0xa6, 0x7b, 0x9e, 0x46, 0xc4, 
+  0xf3, 0xb5, 0x88, 0x76, 0x3e, 0xc8, 0x85, 0x43, 0xa9, 0xc0, 0xb7, 0xa6, 0x69, 0xa8, 0x03, 0x4f, 
+  0x21, 0xee, 0x74, 0x25, 0xf4, 0x94, 0x6f, 0xa8, 0x62, 0x0c, 0x2b, 0x06, 0xd6, 0x76, 0x2e, 0xba, 
+  0xaf, 0x12, 0x7c, 0xd3, 0x8d, 0x2f, 0x67, 0x31, 0x8a, 0x5b, 0x1b, 0xc6, 0xed, 0x8c, 0xe3, 0x6c, 
+  0x38, 0x41, 0xde, 0x5c, 0x04, 0x4a, 0x16, 0x9b, 0x3e, 0x8f, 0x03, 0x1d, 0xee, 0x49, 0x0f, 0xea, 
+  0x5d, 0xb3, 0xe9, 0xd8, 0x46, 0xbb, 0xba, 0x1d, 0x43, 0x93, 0xf6, 0xc0, 0xfa, 0x31, 0xb3, 0xfd, 
+  0xf7, 0x6f, 0xbf, 0x63, 0x0f, 0x80, 0x5e, 0xbc, 0xa5, 0xac, 0xe1, 0xeb, 0xed, 0x79, 0xbb, 0x1d, 
+  0x7f, 0xeb, 0xbc, 0x9b, 0x0d, 0x33, 0x94, 0x1d, 0xba, 0xba, 0xe6, 0x6c, 0x92, 0x89, 0x55, 0x34, 
+  0x0a, 0xab, 0xe5, 0x68, 0x94, 0x8d, 0xff, 0xf8, 0x2d, 0x38, 0x29, 0x54, 0x99, 0x52, 0x8f, 0x41, 
+  0xf1, 0x91, 0x30, 0x98, 0xb8, 0x24, 0xc3, 0xb6, 0xc0, 0x14, 0x45, 0x6a, 0x2c, 0xf4, 0xf0, 0x4f, 
+  0xec, 0xd1, 0x19, 0x7c, 0x0b, 0xfe, 0x1c, 0xa9, 0x61, 0xf4, 0x41, 0x91, 0x50, 0xe3, 0x7a, 0x6c, 
+  0x47, 0x2f, 0x36, 0xb6, 0xbb, 0xb2, 0x5b, 0x7b, 0x75, 0x4c, 0xef, 0xd7, 0x7a, 0x2a, 0x97, 0x77, 
+  0x71, 0x2f, 0xe1, 0xe6, 0x6e, 0xcb, 0xb8, 0x1f, 0x7b, 0x23, 0xda, 0x1a, 0x35, 0x1f, 0x93, 0xdc, 
+  0x2b, 0x06, 0x8e, 0x0e, 0xae, 0xb6, 0x32, 0x71, 0xcc, 0xf8, 0x34, 0xd8, 0xb9, 0xae, 0x67, 0xf6, 
+  0x88, 0xec, 0x9e, 0x90, 0x67, 0x09, 0xf5, 0x60, 0x36, 0x12, 0x50, 0x31, 0x9d, 0x82, 0xd7, 0xf5, 
+  0x15, 0x1e, 0x02, 0x31, 0x1a, 0x0f, 0xf3, 0x5c, 0xab, 0x2f, 0xa8, 0x26, 0x75, 0xdf, 0x68, 0x29, 
+  0x2e, 0xe2, 0x95, 0xc4, 0x42, 0xb5, 0xc6, 0x30, 0xab, 0x4e, 0xca, 0xad, 0x8d, 0x96, 0x03, 0x30, 
+  0x0a, 0xc0, 0x02, 0xda, 0x3c, 0x38, 0x22, 0x2b, 0xc1, 0xcf, 0x3f, 0xfc, 0x29, 0xb4, 0x0a, 0x8a, 
+  0x0f, 0x8e, 0xc8, 0x46, 0x98, 0x13, 0x42, 0x37, 0xbb, 0xe3, 0x5d, 0xd2, 0x76, 0x0c, 0xac, 0x56, 
+  0x44, 0x1a, 0xbc, 0x6b, 0x0c, 0x17, 0x90, 0xa5, 0x61, 0xe6, 0xae, 0xdc, 0x79, 0x89, 0x4a, 0x55, 
+  0xcc, 0x56, 0xb5, 0xe8, 0x11, 0x2a, 0x7e, 0x65, 0xac, 0xfe, 0xec, 0x59, 0xac, 0x9a, 0x7c, 0xa9, 
+  0x22, 0xa2, 0xaa, 0xf4, 0x64, 0xe7, 0x50, 0x97, 0x71, 0xe6, 0x6b, 0x35, 0x4b, 0xa5, 0xb1, 0xe6, 
+  0x91, 0xf3, 0x1d, 0x54, 0xb3, 0x27, 0x07, 0x10, 0xe2, 0x02, 0x2e, 0x3b, 0x4d, 0x56, 0x23, 0x7a, 
+  0xb9, 0xcd, 0x4d, 0xea, 0xe3, 0xa6, 0x14, 0x5f, 0x92, 0xd5, 0xad, 0xcb, 0x6f, 0xdb, 0xa8, 0xc7, 
+  0x1c, 0x3c, 0x69, 0x82, 0x5e, 0x1f, 0x95, 0x9e, 0x51, 0xed, 0x60, 0x67, 0x30, 0x18, 0x98, 0x44, 
+  0x99, 0x7b, 0xb6, 0x08, 0x71, 0xeb, 0x6c, 0xa1, 0xad, 0x2c, 0x06, 0x45, 0x7b, 0x99, 0xb6, 0x35, 
+  0xbb, 0x7f, 0x86, 0x0c, 0xa2, 0x34, 0x07, 0xd3, 0x5a, 0x11, 0x28, 0xe2, 0xe1, 0xca, 0x34, 0xaa, 
+  0x6c, 0x34, 0xaa, 0xc8, 0x10, 0xd9, 0xa1, 0x84, 0xfb, 0x0d, 0x60, 0x45, 0x9d, 0x2e, 0x8a, 0xc8, 
+  0xf9, 0xc0, 0x82, 0xa6, 0xd4, 0xa7, 0x21, 0xa1, 0x44, 0x7c, 0xeb, 0x7c, 0xf9, 0xd4, 0xd1, 0x85, 
+  0xb6, 0xca, 0x9b, 0x3d, 0x4f, 0x2b, 0x09, 0x79, 0x21, 0xd8, 0x62, 0xa3, 0xec, 0x56, 0xd6, 0x7f, 
+  0x5a, 0x7f, 0x1a, 0x27, 0xb9, 0xea, 0xd9, 0xa6, 0xf6, 0x85, 0x32, 0x5d, 0x5d, 0x3d, 0x44, 0x00, 
+  0xe2, 0xb7, 0xbb, 0x69, 0xe5, 0xee, 0x00, 0x2b, 0x41, 0x43, 0xfe, 0x00, 0x54, 0x2d, 0x70, 0xa1, 
+  0x1b, 0xd1, 0x43, 0x2a, 0xe4, 0xa2, 0x76, 0x95, 0xd7, 0xf8, 0xb0, 0x5b, 0x13, 0xf0, 0xab, 0x57, 
+  0xeb, 0xad, 0xfc, 0x17, 0x6d, 0x6d, 0xf1, 0x6e, 0x2b, 0x37, 0x86, 0x10, 0x98, 0x9d, 0x36, 0x22, 
+  0xc5, 0x9c, 0xe6, 0x70, 0x75, 0x6d, 0xf9, 0x68, 0x1f, 0x3e, 0x0e, 0x98, 0x07, 0x1f, 0x37, 0x6f, 
+  0x36, 0xe1, 0x2a, 0xab, 0xe6, 0xd1, 0xa5, 0x61, 0x94, 0xbc, 0x71, 0xa9, 0xba, 0xe7, 0x8d, 0x7c, 
+  0xdb, 0xcd, 0xd0, 0x56, 0xc0, 0xbe, 0xc5, 0x43, 0xbf, 0x54, 0x32, 0xc2, 0xb2, 0x73, 0x9e, 0xae, 
+  0x23, 0xc0, 0x9c, 0xa5, 0x2e, 0x46, 0xbd, 0x8b, 0xc9, 0x4f, 0x2c, 0xb4, 0xdb, 0xe4, 0xc5, 0x7b, 
+  0x8d, 0x83, 0xf1, 0x72, 0x79, 0x42, 0x73, 0x17, 0x81, 0xb1, 0xb9, 0xbb, 0xa4, 0xa6, 0x0a, 0x27, 
+  0xd8, 0xd4, 0x99, 0xa2, 0x84, 0x6a, 0x16, 0xbb, 0xab, 0x34, 0x10, 0x8b, 0x59, 0x9b, 0xf1, 0x79, 
+  0xe9, 0x30, 0x1d, 0x5a, 0x76, 0x07, 0xe2, 0xc8, 0xad, 0x1c, 0xb4, 0x51, 0xb4, 0xd2, 0xee, 0xc1, 
+  0x50, 0xd8, 0x8c, 0x20, 0x7b, 0xcd, 0x04, 0xef, 0xb6, 0xe9, 0xd1, 0x36, 0xab, 0xda, 0xa4, 0x19, 
+  0x70, 0xaf, 0xba, 0x8d, 0xbd, 0x2e, 0x1a, 0x5b, 0xb4, 0x84, 0x59, 0x07, 0x36, 0x16, 0x4d, 0xc7, 
+  0x36, 0xed, 0x1b, 0x80, 0x69, 0x5c, 0x90, 0x62, 0x69, 0x31, 0x8f, 0xdb, 0x02, 0x57, 0x59, 0xd9, 
+  0x4c, 0xbc, 0x7c, 0x99, 0xc4, 0x4b, 0x6f, 0xe6, 0x69, 0x39, 0xdd, 0xae, 0x23, 0x45, 0xb5, 0x10, 
+  0x47, 0x3d, 0x66, 0x2b, 0xed, 0xff, 0xe0, 0x78, 0xaa, 0x6d, 0x71, 0x81, 0x00, 0x05, 0xba, 0xbc, 
+  0x05, 0x3e, 0xf1, 0xbc, 0x7b, 0xb7, 0x1c, 0x8e, 0xf9, 0x98, 0x2c, 0xde, 0x86, 0xb7, 0xf7, 0x5b, 
+  0x4d, 0xdd, 0x54, 0xf6, 0x5a, 0x23, 0x60, 0x36, 0x15, 0xb1, 0xe4, 0xcf, 0x4e, 0xe2, 0xb3, 0x16, 
+  0x5c, 0x76, 0x12, 0x03, 0xe4, 0xba, 0x74, 0x46, 0x9f, 0x9d, 0xa1, 0x28, 0xbe, 0xc8, 0x97, 0xb6, 
+  0x39, 0xd9, 0x77, 0xa7, 0xbb, 0x2d, 0xd7, 0x8a, 0x16, 0x3d, 0xdc, 0x9c, 0x2e, 0xa1, 0x1b, 0xa5, 
+  0xb0, 0xe4, 0x0a, 0xf9, 0x21, 0xad, 0x22, 0xb7, 0xe7, 0xe9, 0xec, 0xf3, 0xaa, 0x36, 0x62, 0xb1, 
+  0x7d, 0xd5, 0x95, 0xb9, 0x7b, 0x16, 0x35, 0x40, 0x53, 0xf5, 0x3b, 0x94, 0x18, 0xea, 0x4a, 0x52, 
+  0x6e, 0x03, 0xf6, 0xdd, 0xdc, 0x77, 0x0c, 0x83, 0xa1, 0x9d, 0x24, 0x5a, 0x86, 0x42, 0x8a, 0x61, 
+  0x11, 0x5a, 0xfb, 0xff, 0x8b, 0xcb, 0x56, 0xe2, 0x72, 0xf7, 0xcf, 0x4c, 0x5c, 0x36, 0x88, 0x17, 
+  0x55, 0xaa, 0x64, 0xbe, 0xb6, 0x3d, 0xd0, 0x58, 0x65, 0xb4, 0x2e, 0x85, 0xef, 0xae, 0x8b, 0x04, 
+  0xb9, 0x39, 0xda, 0x80, 0x91, 0x84, 0xc2, 0x59, 0xa0, 0xe2, 0x79, 0x66, 0xf3, 0xca, 0x73, 0x42, 
+  0x0c, 0x6d, 0x7c, 0x4b, 0x74, 0x4f, 0x1f, 0x23, 0xf5, 0xea, 0x82, 0x7f, 0x96, 0xf1, 0xa5, 0x3e, 
+  0x4d, 0xb4, 0xa9, 0x29, 0xf4, 0x5d, 0xd9, 0xbd, 0x64, 0x02, 0x30, 0x75, 0xad, 0xea, 0x8e, 0xad, 
+  0x71, 0x4b, 0x69, 0x41, 0xd6, 0xd5, 0x76, 0x78, 0xcd, 0xec, 0x69, 0xfa, 0xf5, 0xe7, 0x14, 0xb9, 
+  0xae, 0x3c, 0x32, 0x1c, 0x4e, 0xd4, 0x82, 0x0d, 0xf4, 0x26, 0x6f, 0x35, 0xcf, 0xd2, 0xea, 0xc6, 
+  0x94, 0x9d, 0x56, 0x8a, 0x03, 0x96, 0xbc, 0x56, 0x3c, 0xe5, 0x93, 0x3b, 0x3f, 0x65, 0x71, 0x62, 
+  0x23, 0x63, 0x8d, 0x6a, 0xb4, 0xae, 0x4e, 0x8d, 0xae, 0xe0, 0xf8, 0x06, 0x59, 0x43, 0x73, 0x48, 
+  0x32, 0xe7, 0xf5, 0xb0, 0xc7, 0x71, 0xb2, 0x78, 0xe8, 0x29, 0xcf, 0x5e, 0x88, 0xe4, 0xa6, 0xe7, 
+  0x37, 0x8c, 0x10, 0x6d, 0x1a, 0xc9, 0xc4, 0x77, 0x10, 0xbf, 0x4d, 0x64, 0xf2, 0xf2, 0x4b, 0x4d, 
+  0x26, 0x78, 0x1e, 0xc0, 0x69, 0xa2, 0x0c, 0xd5, 0x6a, 0xbb, 0x56, 0x66, 0xb2, 0x28, 0xef, 0x15, 
+  0x45, 0x0d, 0x3f, 0x6c, 0x84, 0x61, 0x2d, 0xb1, 0xad, 0x3e, 0x6f, 0xdb, 0xf8, 0x96, 0x0e, 0x00, 
+  0xec, 0x15, 0xce, 0xc5, 0xde, 0x65, 0x6e, 0x9b, 0xb8, 0x01, 0xfe, 0x29, 0x1e, 0xa2, 0x8e, 0xf0, 
+  0x12, 0x94, 0x57, 0xa9, 0xb4, 0x49, 0x0f, 0x2e, 0x39, 0x5f, 0xf7, 0xe1, 0x55, 0xff, 0x09, 0x9a, 
+  0x3e, 0xb0, 0x4d, 0x68, 0x53, 0x06, 0x9a, 0x23, 0xdc, 0xd6, 0xd1, 0xd2, 0x0c, 0x2d, 0x16, 0x9a, 
+  0x8a, 0x1a, 0x69, 0x2a, 0x2a, 0xd3, 0x54, 0x33, 0xbd, 0x3c, 0x7c, 0xf4, 0xf4, 0xd1, 0xeb, 0x47, 
+  0xed, 0x49, 0xa6, 0xb6, 0x20, 0x7b, 0xed, 0xbf, 0x16, 0xb3, 0xb1, 0xb9, 0x6b, 0x2a, 0x2b, 0xd5, 
+  0xee, 0xba, 0x62, 0xbe, 0x7c, 0x3a, 0xa9, 0x12, 0x0b, 0x28, 0x07, 0xd3, 0xd5, 0x5c, 0x48, 0x98, 
+  0x85, 0x7b, 0xc9, 0x33, 0x4f, 0x44, 0x2f, 0xbd, 0x88, 0x87, 0x4d, 0x55, 0x51, 0xa0, 0x5d, 0xf4, 
+  0x21, 0x19, 0xd3, 0xc5, 0x00, 0x96, 0x92, 0x89, 0x75, 0x9f, 0xec, 0x60, 0x4d, 0xfb, 0xae, 0xaa, 
+  0x7d, 0x96, 0x59, 0x95, 0x32, 0x02, 0x81, 0x38, 0xc9, 0x2e, 0x5b, 0xc8, 0xdd, 0x56, 0xa7, 0x2f, 
+  0xab, 0xeb, 0x1c, 0xb9, 0x54, 0x78, 0x80, 0x85, 0xdb, 0x53, 0x3c, 0x93, 0xcf, 0xe2, 0x04, 0xa3, 
+  0x21, 0x0b, 0x4f, 0x17, 0x73, 0xaf, 0xaf, 0x75, 0x00, 0xe7, 0x19, 0xc6, 0x39, 0x72, 0x5a, 0x57, 
+  0x1a, 0x13, 0x4a, 0x73, 0xae, 0x6d, 0xab, 0xc2, 0x6d, 0x8c, 0x3d, 0xf6, 0x58, 0xb8, 0x7f, 0xad, 
+  0xad, 0x2e, 0xaf, 0xae, 0xde, 0x78, 0x18, 0x94, 0x5c, 0x0b, 0x9c, 0x16, 0xdc, 0x23, 0xbc, 0xdf, 
+  0x79, 0x2a, 0xa2, 0xf4, 0xa0, 0x2d, 0x7a, 0x2e, 0xf1, 0x94, 0x79, 0x3e, 0xa7, 0x3c, 0xb2, 0x79, 
+  0x4c, 0xcb, 0xec, 0x5e, 0xef, 0x2f, 0x98, 0x2a, 0xf2, 0x77, 0x70, 0x6c, 0x2e, 0xde, 0xe8, 0x1c, 
+  0xe1, 0xf1, 0x1e, 0x0d, 0x0e, 0xf3, 0xe3, 0x55, 0x18, 0x10, 0x19, 0xd0, 0x99, 0x57, 0x10, 0x4c, 
+  0x01, 0x9b, 0x26, 0xf1, 0x82, 0xae, 0x67, 0xa0, 0x22, 0xa1, 0x88, 0x23, 0x99, 0x24, 0xfa, 0x29, 
+  0x71, 0x3c, 0x5d, 0x58, 0xf5, 0x4e, 0xb2, 0x41, 0x76, 0x1d, 0x2e, 0x8a, 0x70, 0x50, 0xb1, 0x48, 
+  0x79, 0x0c, 0x59, 0x96, 0x27, 0x20, 0xc5, 0xb3, 0xbb, 0x41, 0xc0, 0x1e, 0xa6, 0xfb, 0x49, 0xd4, 
+  0xda, 0xe9, 0x92, 0x9d, 0x0c, 0xa8, 0xcd, 0x4d, 0x5e, 0x74, 0x61, 0x6e, 0xe7, 0xe8, 0x60, 0x08, 
+  0xcd, 0x4d, 0x01, 0x1c, 0x57, 0xb6, 0x96, 0xfc, 0x36, 0x81, 0x7e, 0x83, 0xa2, 0x52, 0x19, 0x0c, 
+  0x4e, 0xd9, 0x0f, 0x24, 0x62, 0xce, 0x1b, 0x84, 0x97, 0xaa, 0x55, 0x93, 0xc5, 0x3a, 0xce, 0xae, 
+  0xa9, 0x85, 0x2e, 0x85, 0xd3, 0x47, 0x25, 0x10, 0xf8, 0x2f, 0x93, 0x50, 0xa7, 0x3b, 0x62, 0x4d, 
+  0xbe, 0x6e, 0xb8, 0x15, 0x89, 0x86, 0x7f, 0xc9, 0x24, 0x2a, 0x16, 0x33, 0xba, 0x46, 0x8d, 0x2c, 
+  0x80, 0x50, 0x5b, 0x6b, 0x29, 0x71, 0x2c, 0xbc, 0xb3, 0xf4, 0x57, 0x1c, 0xe8, 0xc2, 0x52, 0xbc, 
+  0x00, 0x28, 0xbb, 0x2a, 0x3b, 0x7b, 0x40, 0x57, 0x2a, 0x13, 0xe9, 0xac, 0x2f, 0xe0, 0xd3, 0x17, 
+  0xef, 0x75, 0xd8, 0xf0, 0x88, 0xe2, 0x8f, 0x45, 0x81, 0xef, 0x6e, 0x71, 0x42, 0xa3, 0x2c, 0xdc, 
+  0x74, 0x6d, 0x5e, 0xa3, 0x88, 0xb3, 0x49, 0xb1, 0xaa, 0xbc, 0xc3, 0x9b, 0xb3, 0x76, 0x4c, 0xa2, 
+  0xac, 0x9b, 0x6a, 0xc5, 0x6a, 0x97, 0x4b, 0x6c, 0xf4, 0xfe, 0xe5, 0x37, 0x7a, 0xbf, 0xfd, 0x46, 
+  0xb7, 0x00, 0x15, 0x97, 0x6b, 0x15, 0xcc, 0x36, 0x9e, 0xfd, 0x30, 0x12, 0x6d, 0xc0, 0x8e, 0xe7, 
+  0xf1, 0x29, 0x49, 0x29, 0xdc, 0xc2, 0xf4, 0x62, 0xeb, 0x2b, 0xca, 0xa8, 0xfd, 0xda, 0x2b, 0x27, 
+  0xda, 0xdc, 0xd0, 0x92, 0xca, 0x8b, 0xad, 0x0a, 0xb4, 0xaf, 0x2c, 0xc4, 0x88, 0xec, 0xad, 0xb0, 
+  0xe4, 0x64, 0x97, 0xcd, 0x7b, 0xcf, 0xe4, 0x57, 0xf5, 0xed, 0x05, 0xe3, 0xa1, 0xe4, 0x16, 0xe0, 
+  0xf3, 0xa2, 0x6e, 0x7f, 0xab, 0xb4, 0xa6, 0x81, 0x2d, 0x73, 0x69, 0xd5, 0x46, 0x86, 0x24, 0xba, 
+  0xcb, 0x2e, 0x7f, 0x3a, 0x2c, 0x5c, 0xfe, 0x64, 0x36, 0xb3, 0x13, 0x72, 0xfe, 0x0c, 0xc7, 0x49, 
+  0x70, 0x71, 0x38, 0x5a, 0x7f, 0x97, 0xe2, 0xb0, 0x35, 0x77, 0x16, 0xb4, 0x1e, 0xce, 0x8c, 0xab, 
+  0xc2, 0xc5, 0x78, 0x6f, 0xde, 0xea, 0x7a, 0x75, 0xbe, 0xcf, 0x60, 0x62, 0x4a, 0x47, 0x56, 0xae, 
+  0x37, 0x02, 0xdb, 0x67, 0xe7, 0x06, 0x66, 0xbf, 0x58, 0xb7, 0x26, 0x2f, 0xb8, 0x5c, 0xc9, 0x79, 
+  0x7d, 0x95, 0xb8, 0x21, 0xd3, 0x6e, 0x4b, 0xa9, 0x39, 0x9a, 0x83, 0x41, 0x5d, 0xa5, 0x03, 0x13, 
+  0x20, 0xe3, 0xa6, 0x69, 0xfc, 0x6d, 0xab, 0x5d, 0x0d, 0xbb, 0xbf, 0x39, 0x72, 0x59, 0xd8, 0xfc, 
+  0x96, 0x01, 0x02, 0xdd, 0x73, 0xed, 0x75, 0xfe, 0x5f, 0x09, 0x09, 0xe8, 0xeb, 0x26, 0x28, 0xe1, 
+  0xdd, 0xec, 0xf1, 0xbf, 0x38, 0xfe, 0x50, 0x2e, 0xbf, 0x65, 0x7b, 0xf4, 0x89, 0xc8, 0x46, 0xde, 
+  0x2c, 0xef, 0x0d, 0x75, 0x6b, 0x17, 0x10, 0x30, 0x9f, 0x28, 0xde, 0x9c, 0x25, 0xe6, 0x1f, 0x66, 
+  0x6b, 0xf8, 0x77, 0xe9, 0x59, 0x6f, 0x15, 0x89, 0xd9, 0xe2, 0x9c, 0xb3, 0x16, 0x41, 0xd5, 0xad, 
+  0x6a, 0x3e, 0xe6, 0xa9, 0x2f, 0x01, 0xc8, 0x52, 0x5c, 0x54, 0x38, 0x22, 0xca, 0x1b, 0x59, 0x7f, 
+  0x22, 0x71, 0x83, 0x2e, 0x07, 0x4c, 0x06, 0x11, 0x39, 0xc6, 0x9a, 0x2b, 0xa4, 0xf4, 0xa1, 0x7b, 
+  0x77, 0xfc, 0xb3, 0x81, 0xfb, 0xe6, 0xe7, 0x83, 0xb7, 0x37, 0xbb, 0xdd, 0xbb, 0x37, 0x86, 0x03, 
+  0x7e, 0xc6, 0x31, 0xc0, 0xf8, 0x66, 0xf7, 0xad, 0xd9, 0x7a, 0xca, 0xe7, 0x97, 0xcc, 0x82, 0x4f, 
+  0x9e, 0x0a, 0xba, 0x82, 0xc8, 0x5e, 0xc4, 0xef, 0x81, 0x14, 0xa6, 0x6c, 0xf5, 0xd8, 0x2e, 0x39, 
+  0x37, 0xc0, 0xdb, 0x03, 0xda, 0x13, 0xc0, 0xd7, 0xfb, 0xfd, 0x9a, 0x39, 0xe6, 0x6a, 0xd1, 0x34, 
+  0x07, 0x1e, 0x3a, 0xbd, 0xca, 0x14, 0xef, 0x64, 0xd3, 0x0c, 0xef, 0xbc, 0x13, 0x4f, 0x5f, 0x27, 
+  0x7c, 0x95, 0x79, 0x7c, 0x69, 0x9b, 0x48, 0xbf, 0x97, 0x4d, 0x0d, 0x96, 0xf3, 0x65, 0xed, 0x7b, 
+  0x42, 0xc4, 0xb8, 0x76, 0xa5, 0x71, 0x54, 0xdb, 0xe0, 0xac, 0x61, 0x00, 0x3c, 0xb4, 0x5b, 0xdb, 
+  0xc0, 0x97, 0x27, 0x0d, 0xc8, 0x54, 0x2d, 0x83, 0x74, 0x69, 0x88, 0x2b, 0xaa, 0x61, 0xd7, 0x94, 
+  0x90, 0xb1, 0x96, 0x24, 0x5a, 0x5f, 0xad, 0xe0, 0x0c, 0xe9, 0x3a, 0xfc, 0x01, 0x12, 0x4e, 0x89, 
+  0x79, 0x73, 0xed, 0x75, 0x4e, 0x95, 0x4e, 0xc3, 0x63, 0xcd, 0x99, 0xb5, 0x9d, 0xb7, 0x3e, 0x41, 
+  0x45, 0x57, 0x03, 0x2d, 0x80, 0xb9, 0x6b, 0x46, 0x15, 0x3a, 0x9c, 0x42, 0xb1, 0xb8, 0xbf, 0xf2, 
+  0x97, 0xcb, 0xcd, 0x41, 0x7a, 0xea, 0x3d, 0xd4, 0xdc, 0x80, 0x77, 0x3e, 0xd1, 0x3f, 0xe9, 0x32, 
+  0x53, 0xdb, 0x85, 0x40, 0xab, 0x30, 0xac, 0x1c, 0x00, 0x47, 0x0f, 0x17, 0xa3, 0x08, 0x28, 0xe9, 
+  0x2a, 0x06, 0x61, 0xae, 0x48, 0xb1, 0x49, 0x69, 0x98, 0x22, 0xb0, 0x69, 0xd5, 0x96, 0xcc, 0x5d, 
+  0x66, 0x58, 0x2c, 0xdb, 0x32, 0xdd, 0xcd, 0x88, 0xd1, 0xc6, 0xbc, 0x59, 0xe9, 0x56, 0x2b, 0x0e, 
+  0x9b, 0x6f, 0x74, 0x6c, 0x57, 0x9b, 0x77, 0x99, 0x35, 0xe5, 0x4f, 0xd3, 0x6f, 0xef, 0xd1, 0x9b, 
+  0xfa, 0xd8, 0x1c, 0xf4, 0x36, 0xde, 0x61, 0x7a, 0x27, 0xaa, 0x19, 0xf5, 0x87, 0x39, 0xd4, 0x63, 
+  0x2c, 0x03, 0x8f, 0x38, 0xd2, 0x9d, 0x52, 0xae, 0x6c, 0x2a, 0x80, 0x0c, 0x75, 0x7c, 0xf6, 0x98, 
+  0x7e, 0x52, 0xce, 0x92, 0x03, 0xb5, 0x5e, 0xbe, 0x46, 0x77, 0x58, 0xe0, 0x2e, 0x96, 0x5d, 0xfe, 
+  0x2b, 0xe4, 0xb1, 0x2a, 0x15, 0x91, 0x79, 0xcb, 0xb1, 0x3e, 0x5f, 0xd1, 0x18, 0xaf, 0x4a, 0x9a, 
+  0x82, 0x47, 0xb6, 0x4c, 0x9d, 0x6c, 0x97, 0xa3, 0x4b, 0xc5, 0x4e, 0xaa, 0xb8, 0x36, 0x45, 0x18, 
+  0x21, 0xa6, 0x22, 0x8e, 0xb9, 0x94, 0x84, 0x60, 0xdc, 0x9d, 0x67, 0x71, 0xc0, 0x5d, 0xbc, 0x1f, 
+  0x68, 0xb8, 0x80, 0x6f, 0x29, 0x33, 0x57, 0xae, 0xcb, 0xe2, 0xea, 0xf5, 0x9c, 0x2f, 0xd2, 0x86, 
+  0x0a, 0xbf, 0x52, 0x4b, 0xaf, 0xd2, 0xf2, 0x06, 0x91, 0xd6, 0x31, 0x9d, 0xe3, 0xd2, 0x87, 0x06, 
+  0x77, 0xd9, 0x90, 0x8d, 0xca, 0xcd, 0xca, 0x50, 0x7c, 0x29, 0xf9, 0x71, 0x3c, 0x55, 0xaf, 0xbd, 
+  0x89, 0x74, 0x2b, 0xeb, 0xae, 0x36, 0x87, 0x76, 0x54, 0xf7, 0xb5, 0x67, 0x82, 0xf4, 0x0b, 0x31, 
+  0x9b, 0x87, 0x18, 0x29, 0xba, 0xe7, 0xe3, 0xef, 0x2c, 0x3c, 0x05, 0x6a, 0x35, 0x8d, 0x09, 0x2d, 
+  0x31, 0x30, 0xf0, 0x32, 0x11, 0x91, 0x7a, 0x46, 0xc1, 0xa4, 0x2a, 0xf7, 0x85, 0x78, 0xb5, 0xd1, 
+  0xc2, 0x8b, 0x02, 0x89, 0x75, 0x6b, 0x0f, 0xf4, 0x77, 0xb7, 0x4a, 0x2a, 0x98, 0xef, 0x1e, 0xeb, 
+  0x7b, 0xac, 0x0c, 0x8c, 0x31, 0x01, 0x51, 0xfe, 0x63, 0x7e, 0x3e, 0xb6, 0x58, 0x21, 0xa7, 0xf8, 
+  0xcb, 0x60, 0xce, 0x03, 0x95, 0x84, 0xfd, 0x63, 0x4b, 0x5d, 0xcd, 0xc2, 0xf3, 0xb1, 0x89, 0x9e, 
+  0x1f, 0x5a, 0x55, 0x9d, 0x28, 0x03, 0xaf, 0x80, 0xfd, 0x34, 0x6e, 0x51, 0xc4, 0xc0, 0x4d, 0x57, 
+  0x8c, 0x58, 0xc6, 0xc4, 0xa2, 0xbb, 0x17, 0x11, 0xfe, 0xec, 0x6c, 0xe9, 0x70, 0xd3, 0x85, 0x01, 
+  0xbd, 0xb4, 0x5f, 0x40, 0xf2, 0xae, 0xa3, 0x8b, 0x61, 0x80, 0xaa, 0xeb, 0xa1, 0xb1, 0x70, 0x77, 
+  0xf9, 0xa6, 0xc8, 0xca, 0x54, 0x69, 0x6c, 0xe1, 0xd2, 0xd1, 0xb9, 0x2d, 0xe4, 0x4c, 0xb5, 0xa9, 
+  0xc8, 0x94, 0xea, 0x70, 0x7d, 0x8d, 0x78, 0xac, 0xab, 0x80, 0x4d, 0x3a, 0xe3, 0xc3, 0x30, 0xa4, 
+  0xd1, 0x97, 0xae, 0xbf, 0x5d, 0x07, 0xf7, 0xb8, 0xcd, 0xdd, 0xf1, 0x3c, 0xb3, 0xf4, 0xe3, 0xfd, 
+  0xab, 0x60, 0x85, 0x9b, 0x6b, 0xab, 0xe8, 0x50, 0x24, 0xae, 0x58, 0xeb, 0x04, 0xaa, 0x61, 0xb3, 
+  0x1c, 0x05, 0x16, 0xbd, 0x46, 0x81, 0x0c, 0x90, 0x7c, 0x28, 0x79, 0x1c, 0x18, 0x3a, 0xc5, 0x25, 
+  0x2f, 0xaf, 0x5b, 0x76, 0xb7, 0x37, 0xf7, 0x24, 0x28, 0xdb, 0xf5, 0x08, 0xfa, 0x5a, 0x84, 0x6a, 
+  0xcd, 0xcc, 0x45, 0xd7, 0xec, 0x12, 0xca, 0xb6, 0x4e, 0x7a, 0xaa, 0x07, 0xe2, 0x6d, 0x68, 0x20, 
+  0xbd, 0xef, 0xa7, 0x89, 0x0c, 0xd6, 0x0c, 0x65, 0x2c, 0x47, 0xb7, 0x12, 0x41, 0xfb, 0xdb, 0x8f, 
+  0x2a, 0xe3, 0x86, 0x75, 0xbe, 0x68, 0x1c, 0xdd, 0x8f, 0x83, 0x73, 0x2a, 0x9e, 0x35, 0x5d, 0x37, 
+  0xc4, 0xf5, 0x25, 0x11, 0xbf, 0xb8, 0x28, 0xff, 0xcc, 0x0b, 0xdd, 0x12, 0xb1, 0xb9, 0x04, 0x19, 
+  0xac, 0xb5, 0xcd, 0x1d, 0x0d, 0x6f, 0xee, 0x7e, 0xf2, 0xf6, 0x26, 0x38, 0x9b, 0x87, 0xf0, 0xd1, 
+  0x3d, 0x84, 0x2f, 0x9f, 0xbc, 0xfd, 0xb4, 0x3b, 0x9c, 0x89, 0x5e, 0x21, 0xa2, 0x84, 0x8c, 0x60, 
+  0x42, 0x50, 0x04, 0xfb, 0x8d, 0x26, 0x6c, 0xad, 0x58, 0xca, 0x47, 0xbb, 0x77, 0x0a, 0x69, 0x48, 
+  0xba, 0x45, 0x16, 0xfa, 0x17, 0x9c, 0xec, 0xcc, 0x58, 0x83, 0xd5, 0xd0, 0x45, 0x62, 0xf8, 0x19, 
+  0x82, 0xd4, 0xc4, 0x4f, 0xd2, 0xb7, 0x65, 0x69, 0x52, 0xb8, 0x06, 0xd5, 0xd1, 0xbf, 0xb7, 0x08, 
+  0xbd, 0xe9, 0x67, 0x08, 0x0f, 0xf3, 0xf7, 0x34, 0x39, 0xf8, 0x48, 0x47, 0x20, 0x2a, 0x24, 0x67, 
+  0x33, 0x61, 0x0d, 0x3f, 0xca, 0x4d, 0x16, 0x3d, 0x39, 0x8f, 0x1b, 0x44, 0xdb, 0x53, 0xad, 0xb8, 
+  0x46, 0xbc, 0x54, 0x28, 0xc6, 0xc3, 0xd0, 0xf1, 0xcc, 0x75, 0x1e, 0x78, 0x11, 0x46, 0xe5, 0x89, 
+  0xdd, 0xd2, 0x0c, 0xe2, 0x3a, 0xd3, 0x78, 0xca, 0x27, 0x08, 0xf8, 0x39, 0x32, 0x33, 0x1d, 0x26, 
+  0x60, 0x7e, 0xbc, 0x3c, 0xcf, 0x53, 0xbd, 0x9b, 0xfe, 0xe6, 0xce, 0xa6, 0x42, 0x5d, 0xbb, 0xb1, 
+  0x5d, 0x90, 0x98, 0x89, 0x4f, 0xee, 0x52, 0x2e, 0x37, 0x99, 0x93, 0x28, 0xba, 0xdd, 0xc0, 0x93, 
+  0xe7, 0x91, 0x5f, 0xba, 0xb0, 0x75, 0x7d, 0x82, 0x0c, 0x71, 0x57, 0xbc, 0x6f, 0x94, 0x3a, 0xa5, 
+  0x11, 0x5d, 0xd3, 0x6f, 0xf2, 0xe0, 0x99, 0x33, 0xa6, 0x65, 0xc7, 0x61, 0x9e, 0x3c, 0x37, 0xbf, 
+  0xd2, 0x43, 0x39, 0x79, 0x11, 0x1c, 0xea, 0x7d, 0x39, 0xd2, 0xb9, 0xf5, 0xca, 0x5b, 0xdc, 0x19, 
+  0xdb, 0x3b, 0x4d, 0x0f, 0xb6, 0xb7, 0xd9, 0xcf, 0x23, 0xea, 0x34, 0x45, 0x96, 0xfe, 0x42, 0x57, 
+  0xc0, 0xd6, 0x23, 0x8d, 0x7b, 0x1e, 0x15, 0xf6, 0x7f, 0xfd, 0x03, 0x12, 0xb9, 0x9f, 0xb0, 0xc9, 
+  0x7e, 0xd0, 0xa1, 0xd8, 0x70, 0x92, 0x94, 0x1e, 0xe0, 0xb0, 0xfa, 0xf7, 0x25, 0xf2, 0xbf, 0x2a, 
+  0x75, 0x94, 0x0a, 0x68, 0x4a, 0xaf, 0x14, 0xe1, 0xd8, 0xfc, 0xf3, 0x60, 0x88, 0x08, 0x3c, 0xba, 
+  0x76, 0x30, 0x44, 0x57, 0xff, 0xe8, 0xda, 0xff, 0x02, 0x97, 0x82, 0xb8, 0x65, 0x01, 0x82, 0x00, 
+  0x00
 };
@@ -1,53 +1,194 @@
 #include "mimetable.h"
 #include <pgmspace.h>
+#include <vector>
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
 
 namespace mimetype {
 
+namespace {
+
+struct MimeEntry {
+  char ext[10];     // Lowercase extension without the dot
+  char type[32];
+};
+
 // MIME type lookup table stored in PROGMEM
-static const struct {
-  const char ext[16];
-  const char type[32];
-} mimeTable[] PROGMEM = {
-  {".html", "text/html"},
-  {".htm", "text/html"},
-  {".css", "text/css"},
-  {".txt", "text/plain"},
-  {".js", "application/javascript"},
-  {".mjs", "text/javascript"},
-  {".json", "application/json"},
-  {".png", "image/png"},
-  {".gif", "image/gif"},
-  {".jpg", "image/jpeg"},
-  {".ico", "image/x-icon"},
-  {".svg", "image/svg+xml"},
-  {".svg.gz", "image/svg+xml"},
-  {".ttf", "application/x-font-ttf"},
-  {".otf", "application/x-font-opentype"},
-  {".woff", "application/font-woff"},
-  {".woff2", "application/font-woff2"},
-  {".eot", "application/vnd.ms-fontobject"},
-  {".sfnt", "application/font-sfnt"},
-  {".xml", "text/xml"},
-  {".pdf", "application/pdf"},
-  {".zip", "application/zip"},
-  {".gz", "application/x-gzip"},
-  {".appcache", "text/cache-manifest"},
+constexpr MimeEntry mimeTable[] PROGMEM = {
+  {"html", "text/html"},
+  {"htm", "text/html"},
+  {"css", "text/css"},
+  {"txt", "text/plain"},
+  {"js", "application/javascript"},
+  {"mjs", "text/javascript"},
+  {"json", "application/json"},
+  {"png", "image/png"},
+  {"gif", "image/gif"},
+  {"jpg", "image/jpeg"},
+  {"jpeg", "image/jpeg"},
+  {"ico", "image/x-icon"},
+  {"svg", "image/svg+xml"},
+  {"ttf", "application/x-font-ttf"},
+  {"otf", "application/x-font-opentype"},
+  {"woff", "application/font-woff"},
+  {"woff2", "application/font-woff2"},
+  {"eot", "application/vnd.ms-fontobject"},
+  {"sfnt", "application/font-sfnt"},
+  {"xml", "text/xml"},
+  {"pdf", "application/pdf"},
+  {"zip", "application/zip"},
+  {"gz", "application/x-gzip"},
+  {"appcache", "text/cache-manifest"},
+};
+constexpr size_t MIME_COUNT = sizeof(mimeTable) / sizeof(mimeTable[0]);
+constexpr size_t MIME_GZIP = 22;        // "gz" entry
+constexpr size_t MIME_SVG = 12;         // "svg" entry, used for ".svg.gz"
+
+constexpr bool sameExt(const char *a, const char *b) {
+  return *a == *b && (*a == '\0' || sameExt(a + 1, b + 1));
+}
+static_assert(sameExt(mimeTable[MIME_GZIP].ext, "gz") && sameExt(mimeTable[MIME_SVG].ext, "svg"),
+              "MIME_GZIP / MIME_SVG must match the table order");
+
+const char s_defaultType[] PROGMEM = "application/octet-stream";
+
+constexpr size_t SLOT_COUNT = 128;      // Power of two, >= 4x MIME_COUNT to find a seed quickly
+constexpr uint8_t SLOT_EMPTY = 0xFF;
+
+constexpr uint32_t hashExt(const char *ext, uint32_t seed) {
+  uint32_t hash = 2166136261u ^ seed;
+  for (size_t i = 0; ext[i]; ++i) {
+    hash ^= static_cast<uint8_t>(ext[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+struct SlotTable {
+  uint32_t seed;
+  uint8_t slots[SLOT_COUNT];
 };
 
-String getContentType(const String &path) {
-  char buff[32];
-  
-  // Check all entries for extension match
-  for (size_t i = 0; i < sizeof(mimeTable) / sizeof(mimeTable[0]); i++) {
-    strcpy_P(buff, mimeTable[i].ext);
-    if (path.endsWith(buff)) {
-      strcpy_P(buff, mimeTable[i].type);
-      return String(buff);
+// Try seeds until every built-in extension lands in its own slot (perfect hash)
+constexpr SlotTable buildSlots() {
+  SlotTable table{0, {}};
+  for (uint32_t seed = 0; seed < 100000; ++seed) {
+    for (size_t s = 0; s < SLOT_COUNT; ++s) {
+      table.slots[s] = SLOT_EMPTY;
     }
+    bool collision = false;
+    for (size_t i = 0; i < MIME_COUNT && !collision; ++i) {
+      size_t slot = hashExt(mimeTable[i].ext, seed) & (SLOT_COUNT - 1);
+      collision = table.slots[slot] != SLOT_EMPTY;
+      table.slots[slot] = static_cast<uint8_t>(i);
+    }
+    if (!collision) {
+      table.seed = seed;
+      return table;
+    }
+  }
+  table.seed = UINT32_MAX;
+  return table;
+}
+
+constexpr SlotTable s_slotTable PROGMEM = buildSlots();
+static_assert(s_slotTable.seed != UINT32_MAX, "No perfect hash seed for the MIME table");
+static_assert(MIME_COUNT < SLOT_EMPTY, "Too many MIME entries");
+
+struct ExtraType {
+  char *ext;
+  char *type;
+};
+std::vector<ExtraType> s_extraTypes;
+
+#if defined(ESP32)
+// Types may be registered from loop() while the server task looks them up
+SemaphoreHandle_t s_extraLock = xSemaphoreCreateMutex();
+
+struct ExtraLock {
+  ExtraLock() : m_lock(s_extraLock) {
+    if (m_lock) {
+      xSemaphoreTake(m_lock, portMAX_DELAY);
+    }
+  }
+  ~ExtraLock() {
+    if (m_lock) {
+      xSemaphoreGive(m_lock);
+    }
+  }
+  SemaphoreHandle_t m_lock;
+};
+#define EXTRA_LOCK() ExtraLock lock
+#else
+#define EXTRA_LOCK()
+#endif
+
+}  // namespace
+
+bool registerType(const char *ext, const char *type) {
+  if (!ext || !type || !*ext) {
+    return false;
+  }
+  EXTRA_LOCK();
+  for (const ExtraType &extra : s_extraTypes) {
+    if (strcasecmp(extra.ext, ext) == 0 && strcmp(extra.type, type) == 0) {
+      return true;
+    }
+  }
+  ExtraType extra = {strdup(ext), strdup(type)};
+  if (!extra.ext || !extra.type) {
+    free(extra.ext);
+    free(extra.type);
+    return false;
+  }
+  // Never freed: getContentType() may have returned an older type for the same extension
+  s_extraTypes.push_back(extra);
+  return true;
+}
+
+const char *getContentType(const char *path) {
+  if (!path) {
+    return s_defaultType;
+  }
+  size_t len = strlen(path);
+
+  // Runtime registered types first, newest first (few entries, compound extensions allowed)
+  {
+    EXTRA_LOCK();
+    for (auto it = s_extraTypes.rbegin(); it != s_extraTypes.rend(); ++it) {
+      size_t extLen = strlen(it->ext);
+      if (extLen <= len && strcasecmp(path + len - extLen, it->ext) == 0) {
+        return it->type;
+      }
+    }
+  }
+
+  const char *dot = strrchr(path, '.');
+  if (!dot || strchr(dot, '/')) {
+    return s_defaultType;
+  }
+  char ext[sizeof(MimeEntry::ext)];
+  size_t extLen = len - (dot + 1 - path);
+  if (extLen == 0 || extLen >= sizeof(ext)) {
+    return s_defaultType;
+  }
+  for (size_t i = 0; i <= extLen; ++i) {
+    ext[i] = tolower(static_cast<unsigned char>(dot[1 + i]));
+  }
+
+  uint32_t seed = pgm_read_dword(&s_slotTable.seed);
+  uint8_t index = pgm_read_byte(&s_slotTable.slots[hashExt(ext, seed) & (SLOT_COUNT - 1)]);
+  if (index == SLOT_EMPTY || strcmp_P(ext, mimeTable[index].ext) != 0) {
+    return s_defaultType;
+  }
+
+  // Pre-compressed SVG keeps its own type (served with Content-Encoding: gzip)
+  if (index == MIME_GZIP && len > 7 && strncasecmp(path + len - 7, ".svg.gz", 7) == 0) {
+    return mimeTable[MIME_SVG].type;
   }
-  
-  // Default to octet-stream if no match
-  return String(F("application/octet-stream"));
+  return mimeTable[index].type;
 }
 
 }  // namespace mimetype
@@ -4,9 +4,23 @@
 
 namespace mimetype {
 
-// Minimal MIME type helper - delegates to ESP32 WebServer core when possible
-// Falls back to local implementation if WebServer::getContentType is unavailable
-String getContentType(const String &path);
+/*
+  Content type for path, from its extension (case insensitive).
+  Built-in types are looked up in a perfect hash table generated at compile time
+  and the returned pointer refers to flash (PROGMEM on ESP8266: read it with FPSTR()
+  or the *_P functions). Unknown extensions return "application/octet-stream".
+*/
+const char *getContentType(const char *path);
+
+inline const char *getContentType(const String &path) { return getContentType(path.c_str()); }
+
+/*
+  Register an extra type at runtime, e.g. registerType(".wasm", "application/wasm").
+  ext may be compound (".svg.gz"). Registered types are checked newest first and before
+  the built-in table, so registering an extension again overrides it. Strings are copied
+  and kept for the program lifetime. Safe to call while the server task is running (ESP32)
+*/
+bool registerType(const char *ext, const char *type);
 
 }  // namespace mimetype
 
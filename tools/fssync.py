@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""
+Differential upload of a local folder (e.g. the sketch "data" folder) to a device.
+
+The device manifest (GET /sync/manifest) is compared with the local files by size
+and CRC32: only new and changed files are packed in a tar archive and sent with a
+single POST /sync/apply request. With --delete, files missing locally are removed
+from the device too.
+
+Usage:
+    python tools/fssync.py esphost.local data [--dir /] [--delete] [--gzip]
+                           [--exclude "*.map"] [--user admin --password secret] [--dry-run]
+"""
+
+import argparse
+import base64
+import fnmatch
+import io
+import json
+import os
+import sys
+import tarfile
+import urllib.parse
+import urllib.request
+import zlib
+
+DELETE_LIST = ".sync-delete"   # Same name as ESP_FS_WS_SYNC_DELETE_LIST
+
+
+def collect(root, excludes):
+    files = {}
+    for folder, _, names in os.walk(root):
+        for name in names:
+            full = os.path.join(folder, name)
+            rel = os.path.relpath(full, root).replace(os.sep, "/")
+            if any(fnmatch.fnmatch("/" + rel, pattern) for pattern in excludes):
+                continue
+            files[rel] = full
+    return files
+
+
+def crc32_file(path):
+    crc = 0
+    with open(path, "rb") as f:
+        for block in iter(lambda: f.read(65536), b""):
+            crc = zlib.crc32(block, crc)
+    return crc & 0xFFFFFFFF
+
+
+def request(url, args, data=None, content_type=None):
+    req = urllib.request.Request(url, data=data, method="POST" if data is not None else "GET")
+    if content_type:
+        req.add_header("Content-Type", content_type)
+    if args.user:
+        token = base64.b64encode(("%s:%s" % (args.user, args.password or "")).encode()).decode()
+        req.add_header("Authorization", "Basic " + token)
+    with urllib.request.urlopen(req, timeout=args.timeout) as reply:
+        return reply.read()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Upload only the changed files of a folder to an FSWebServer device")
+    parser.add_argument("host", help="device address, e.g. esphost.local or 192.168.4.1:80")
+    parser.add_argument("source", help="local folder to mirror (e.g. data)")
+    parser.add_argument("-d", "--dir", default="/", help="target folder on the device")
+    parser.add_argument("--delete", action="store_true", help="remove device files missing locally")
+    parser.add_argument("-z", "--gzip", action="store_true", help="compress the archive (ESP32 only)")
+    parser.add_argument("-x", "--exclude", action="append", default=[], help="glob of paths to skip")
+    parser.add_argument("-u", "--user", help="user name, if the server requires authentication")
+    parser.add_argument("-p", "--password", help="password")
+    parser.add_argument("-n", "--dry-run", action="store_true", help="only print what would change")
+    parser.add_argument("-t", "--timeout", type=float, default=60, help="HTTP timeout in seconds")
+    args = parser.parse_args()
+
+    base = args.host if "://" in args.host else "http://" + args.host
+    query = urllib.parse.urlencode({"dir": args.dir})
+
+    manifest = json.loads(request("%s/sync/manifest?%s" % (base, query), args))
+    remote = {entry["path"]: (entry["size"], int(entry["crc"], 16)) for entry in manifest}
+    local = collect(args.source, args.exclude)
+
+    changed = []
+    for rel, full in sorted(local.items()):
+        size = os.path.getsize(full)
+        if remote.get(rel) != (size, crc32_file(full)):
+            changed.append(rel)
+    deleted = sorted(set(remote) - set(local)) if args.delete else []
+
+    for rel in changed:
+        print("%s %s" % ("M" if rel in remote else "A", rel))
+    for rel in deleted:
+        print("D %s" % rel)
+    if not changed and not deleted:
+        print("Up to date (%d files)" % len(local))
+        return
+    if args.dry_run:
+        return
+
+    archive = io.BytesIO()
+    with tarfile.open(fileobj=archive, mode="w:gz" if args.gzip else "w", format=tarfile.GNU_FORMAT) as tar:
+        for rel in changed:
+            tar.add(local[rel], arcname=rel, recursive=False)
+        if deleted:
+            listing = ("\n".join(deleted) + "\n").encode()
+            info = tarfile.TarInfo(DELETE_LIST)
+            info.size = len(listing)
+            tar.addfile(info, io.BytesIO(listing))
+
+    body = archive.getvalue()
+    reply = json.loads(request("%s/sync/apply?%s" % (base, query), args, body,
+                               "application/gzip" if args.gzip else "application/x-tar"))
+    total = sum(os.path.getsize(full) for full in local.values())
+    print("Sent %d bytes (%d files, %d deleted) instead of %d" %
+          (len(body), reply.get("files", 0), reply.get("deleted", 0), total))
+    if "error" in reply:
+        sys.exit("Device error: %s" % reply["error"])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""
+Build a ROMFS image header from a folder (e.g. the sketch "data" folder).
+
+The generated header holds every file in a single PROGMEM array plus a sorted
+index (path, mime type, offset, length, encoding, FNV-1a hash) and can be
+mounted with FSWebServer::mountRomFs():
+
+    #include "romfs_data.h"
+    server.mountRomFs(romfs_data);
+
+Usage:
+    python tools/romfs.py data -o romfs_data.h [--name romfs_data] [--gzip] [--exclude "*.map"]
+
+Files named "<name>.gz" are stored as "<name>" with gzip encoding. With --gzip,
+text files are compressed at build time when this makes them smaller.
+"""
+
+import argparse
+import fnmatch
+import gzip
+import mimetypes
+import os
+import sys
+
+# Same types used by the library mime table, for consistent Content-Type headers
+MIME_TYPES = {
+    ".htm": "text/html", ".html": "text/html", ".css": "text/css", ".txt": "text/plain",
+    ".js": "application/javascript", ".mjs": "text/javascript", ".json": "application/json",
+    ".png": "image/png", ".gif": "image/gif", ".jpg": "image/jpeg", ".jpeg": "image/jpeg",
+    ".ico": "image/x-icon", ".svg": "image/svg+xml", ".webp": "image/webp",
+    ".ttf": "application/x-font-ttf", ".otf": "application/x-font-opentype",
+    ".woff": "application/font-woff", ".woff2": "application/font-woff2",
+    ".eot": "application/vnd.ms-fontobject", ".xml": "text/xml", ".pdf": "application/pdf",
+    ".zip": "application/zip", ".csv": "text/csv", ".wasm": "application/wasm",
+    ".webmanifest": "application/manifest+json", ".map": "application/json",
+}
+
+COMPRESSIBLE = ("text/", "application/javascript", "application/json", "image/svg+xml",
+                "text/xml", "application/manifest+json", "application/wasm")
+
+ALIGN = 4
+
+
+def fnv1a32(data):
+    h = 2166136261
+    for b in data:
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def mime_type(path):
+    ext = os.path.splitext(path)[1].lower()
+    if ext in MIME_TYPES:
+        return MIME_TYPES[ext]
+    guess, _ = mimetypes.guess_type(path)
+    return guess or "application/octet-stream"
+
+
+def collect(root, excludes):
+    files = {}
+    for folder, _, names in os.walk(root):
+        for name in names:
+            full = os.path.join(folder, name)
+            rel = "/" + os.path.relpath(full, root).replace(os.sep, "/")
+            if any(fnmatch.fnmatch(rel, pattern) for pattern in excludes):
+                continue
+            with open(full, "rb") as f:
+                data = f.read()
+            if rel.endswith(".gz") and mime_type(rel[:-3]) != "application/octet-stream":
+                files[rel[:-3]] = (data, 1)
+            elif rel not in files:
+                files[rel] = (data, 0)
+    return files
+
+
+def c_array(data, indent="  "):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a folder into a ROMFS PROGMEM image header")
+    parser.add_argument("source", help="folder to embed (e.g. data)")
+    parser.add_argument("-o", "--output", default="romfs_data.h", help="header file to write")
+    parser.add_argument("-n", "--name", default="romfs_data", help="C identifier of the RomFsImage")
+    parser.add_argument("-z", "--gzip", action="store_true", help="gzip compress text files")
+    parser.add_argument("-x", "--exclude", action="append", default=[], help="glob of paths to skip")
+    args = parser.parse_args()
+
+    if not os.path.isdir(args.source):
+        sys.exit("Source folder %s not found" % args.source)
+
+    files = collect(args.source, args.exclude)
+    # Binary search on the device compares paths byte by byte (strcmp)
+    paths = sorted(files, key=lambda p: p.encode("utf-8"))
+
+    blob = bytearray()
+    entries = []
+    for path in paths:
+        data, encoding = files[path]
+        mime = mime_type(path)
+        if args.gzip and encoding == 0 and mime.startswith(COMPRESSIBLE):
+            packed = gzip.compress(data, compresslevel=9, mtime=0)
+            if len(packed) < len(data):
+                data, encoding = packed, 1
+        while len(blob) % ALIGN:
+            blob.append(0)
+        entries.append((path, mime, len(blob), len(data), fnv1a32(data), encoding))
+        blob.extend(data)
+
+    mimes = sorted(set(e[1] for e in entries))
+    name = args.name
+    out = []
+    out.append("// Auto Generated file (tools/romfs.py %s)" % os.path.basename(os.path.normpath(args.source)))
+    out.append("#pragma once")
+    out.append("#include <pgmspace.h>")
+    out.append("#include <RomFs.h>")
+    out.append("")
+    out.append("const uint8_t %s_blob[%d] PROGMEM = {" % (name, max(len(blob), 1)))
+    out.append(c_array(bytes(blob) or b"\0"))
+    out.append("};")
+    out.append("")
+    for i, (path, _, _, _, _, _) in enumerate(entries):
+        out.append("const char %s_path%d[] PROGMEM = \"%s\";" % (name, i, path.replace("\\", "\\\\").replace("\"", "\\\"")))
+    for i, mime in enumerate(mimes):
+        out.append("const char %s_mime%d[] PROGMEM = \"%s\";" % (name, i, mime))
+    out.append("")
+    out.append("const RomFsEntry %s_index[%d] PROGMEM = {" % (name, max(len(entries), 1)))
+    for i, (path, mime, offset, length, digest, encoding) in enumerate(entries):
+        out.append("  {%s_path%d, %s_mime%d, %d, %d, 0x%08x, %s},  // %s" % (
+            name, i, name, mimes.index(mime), offset, length, digest,
+            "ROMFS_GZIP" if encoding else "ROMFS_IDENTITY", path))
+    if not entries:
+        out.append("  {nullptr, nullptr, 0, 0, 0, ROMFS_IDENTITY},")
+    out.append("};")
+    out.append("")
+    out.append("const RomFsImage %s = {%s_blob, %s_index, %d};" % (name, name, name, len(entries)))
+    out.append("")
+
+    with open(args.output, "w", newline="\n") as f:
+        f.write("\n".join(out))
+    print("%s: %d files, %d bytes" % (args.output, len(entries), len(blob)))
+
+
+if __name__ == "__main__":
+    main()